@@ -0,0 +1,27 @@
+#pragma once
+#include "Aquarium.h"
+
+// Scripted stand-in for the keyboard: swim towards the nearest creature the
+// player can eat and away from the nearest one it cannot.
+inline void steerPlayer(Aquarium& aquarium, PlayerCreature& player) {
+    float px = player.getX();
+    float py = player.getY();
+    float bestEdible = -1.0f, bestThreat = -1.0f;
+    float ex = 0, ey = 0, tx = 0, ty = 0;
+    for (int i = 0; i < aquarium.getCreatureCount(); ++i) {
+        auto creature = aquarium.getCreatureAt(i);
+        float dx = creature->getX() - px;
+        float dy = creature->getY() - py;
+        float d2 = dx * dx + dy * dy;
+        if (creature->getValue() <= player.getPower()) {
+            if (bestEdible < 0 || d2 < bestEdible) { bestEdible = d2; ex = dx; ey = dy; }
+        } else if (bestThreat < 0 || d2 < bestThreat) {
+            bestThreat = d2; tx = dx; ty = dy;
+        }
+    }
+    if (bestThreat >= 0 && bestThreat < 120.0f * 120.0f) {
+        player.setDirection(tx > 0 ? -1 : 1, ty > 0 ? -1 : 1);
+    } else if (bestEdible >= 0) {
+        player.setDirection(ex > 1 ? 1 : (ex < -1 ? -1 : 0), ey > 1 ? 1 : (ey < -1 ? -1 : 0));
+    }
+}
@@ -0,0 +1,356 @@
+// Benchmark suite for the simulation core: micro-benchmarks of the hot tank
+// operations across populations, sprite spawn cost and memory, and
+// whole-campaign playthroughs with the scripted player. Everything is seeded, and the results are written as JSON
+// so runs from two commits can be diffed. Built with headless/Makefile.
+//
+//     ./build/aquarium_bench --out bench.json
+//     ./build/aquarium_bench --max-population 10000 --playthroughs 2
+//     ./build/aquarium_bench --spawns 1000
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Aquarium.h"
+#include "LevelLoader.h"
+#include "ScriptedPlayer.h"
+
+namespace {
+
+constexpr uint64_t kBenchSeed = 12345;
+constexpr int kRepeats = 3; // each micro-benchmark reports the best of these
+
+struct BenchOptions {
+    std::string out;
+    std::string levels = "bin/data/settings.xml";
+    int maxPopulation = 100000;
+    int playthroughs = 5;
+    int frames = 20000;
+    int spawns = 100; // a level's repopulation; the copies hold ~200 KB each
+};
+
+BenchOptions parseArgs(int argc, char** argv) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--out") == 0) {
+            options.out = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--levels") == 0) {
+            options.levels = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--max-population") == 0) {
+            options.maxPopulation = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--playthroughs") == 0) {
+            options.playthroughs = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--frames") == 0) {
+            options.frames = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--spawns") == 0) {
+            options.spawns = std::max(1, std::atoi(argv[i + 1]));
+        } else {
+            std::cerr << "unknown option " << argv[i] << std::endl;
+        }
+    }
+    return options;
+}
+
+using Clock = std::chrono::steady_clock;
+
+double nanosSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+struct MicroResult {
+    std::string name;
+    int population;
+    long long ops;
+    double nsPerOp;
+};
+
+struct SpriteResult {
+    std::string name;
+    int spawns;
+    double nsPerSpawn;
+    size_t bytesHeld;
+};
+
+struct Playthrough {
+    uint64_t seed;
+    int frames;
+    std::string outcome;
+    int score;
+    double seconds;
+};
+
+// The predator level's mix (plain, zigzag, bigger, blue, shark) scaled to
+// population creatures, in a tank sized for a few creatures per grid cell.
+struct Tank {
+    std::shared_ptr<Aquarium> aquarium;
+    std::shared_ptr<PlayerCreature> player;
+};
+
+Tank makeTank(const std::shared_ptr<AquariumSpriteManager>& sprites, int population) {
+    const std::pair<AquariumCreatureType, int> mix[] = {
+        {AquariumCreatureType::ZigZagFish, 10},
+        {AquariumCreatureType::BiggerFish, 8},
+        {AquariumCreatureType::BlueFish, 6},
+        {AquariumCreatureType::Shark, 4},
+    };
+    AquariumLevelSpec spec;
+    spec.targetScore = 1000000000;
+    int assigned = 0;
+    for (const auto& entry : mix) {
+        int count = (int)((long long)population * entry.second / 48);
+        spec.population.emplace_back(entry.first, count);
+        assigned += count;
+    }
+    spec.population.emplace_back(AquariumCreatureType::NPCreature, population - assigned);
+
+    int side = (int)std::sqrt(population / 4.0) * 64;
+    Tank tank;
+    tank.aquarium = std::make_shared<Aquarium>(std::max(1024, side), std::max(768, side), sprites, kBenchSeed);
+    tank.aquarium->setSpawnBudget(0);
+    tank.aquarium->setLevels(BuildAquariumLevels({spec}));
+    tank.aquarium->Repopulate();
+    tank.aquarium->spawnQueued();
+    tank.player = std::make_shared<PlayerCreature>(tank.aquarium->getWidth() / 2, tank.aquarium->getHeight() / 2, 3, sprites->GetSprite(AquariumCreatureType::NPCreature));
+    tank.player->setBounds(tank.aquarium->getWidth() - 20, tank.aquarium->getHeight() - 20);
+    return tank;
+}
+
+// Calls run() kRepeats times; run returns the nanoseconds it spent on the
+// measured operations. Keeps the fastest.
+template <typename Run>
+MicroResult measure(const char* name, int population, long long ops, Run&& run) {
+    double best = 0.0;
+    for (int r = 0; r < kRepeats; ++r) {
+        double nanos = run();
+        best = r == 0 ? nanos : std::min(best, nanos);
+    }
+    return {name, population, ops, best / std::max(1LL, ops)};
+}
+
+void runMicro(const BenchOptions& options, std::vector<MicroResult>& results) {
+    auto sprites = std::make_shared<AquariumSpriteManager>();
+    for (int population = 10; population <= options.maxPopulation; population *= 10) {
+        std::cerr << "population " << population << std::endl;
+        Tank tank = makeTank(sprites, population);
+        Aquarium& aquarium = *tank.aquarium;
+        aquarium.update(); // settle the grid and scratch buffers
+
+        // narrowphase: the player against every creature
+        const int sweeps = std::max(1, 200000 / population);
+        results.push_back(measure("checkCollision", population, (long long)sweeps * population, [&]() {
+            int hits = 0;
+            auto start = Clock::now();
+            for (int s = 0; s < sweeps; ++s) {
+                for (int i = 0; i < aquarium.getCreatureCount(); ++i) {
+                    hits += checkCollision(*tank.player, *aquarium.getCreatureAt(i)) ? 1 : 0;
+                }
+            }
+            double nanos = nanosSince(start);
+            if (hits < 0) std::cerr << hits; // keep the loop alive
+            return nanos;
+        }));
+
+        // broadphase query around the player
+        const int queries = 2000;
+        results.push_back(measure("DetectAquariumCollisions", population, queries, [&]() {
+            auto start = Clock::now();
+            for (int q = 0; q < queries; ++q) {
+                DetectAquariumCollisions(tank.aquarium, tank.player);
+            }
+            return nanosSince(start);
+        }));
+
+        // full tank tick: movement, respawn, grid rebuild, contacts, predation
+        const int ticks = std::clamp(200000 / population, 3, 200);
+        results.push_back(measure("Aquarium::update", population, ticks, [&]() {
+            auto start = Clock::now();
+            for (int t = 0; t < ticks; ++t) {
+                aquarium.update();
+            }
+            return nanosSince(start);
+        }));
+
+        // removal, repopulation and spawning of 1% of the tank (at least one)
+        const int churn = std::max(1, std::min(population / 100, 1000));
+        RandomGenerator pick(kBenchSeed);
+        double repopulateNanos = 0.0, spawnNanos = 0.0;
+        results.push_back(measure("removeCreature", population, churn, [&]() {
+            double nanos = 0.0;
+            for (int k = 0; k < churn; ++k) {
+                CreatureHandle handle = aquarium.getCreatureAt(pick.nextInt(aquarium.getCreatureCount()))->getHandle();
+                auto start = Clock::now();
+                aquarium.removeCreature(handle);
+                nanos += nanosSince(start);
+            }
+            auto start = Clock::now();
+            aquarium.Repopulate();
+            double repopulate = nanosSince(start);
+            start = Clock::now();
+            aquarium.spawnQueued();
+            double spawn = nanosSince(start);
+            repopulateNanos = repopulateNanos == 0.0 ? repopulate : std::min(repopulateNanos, repopulate);
+            spawnNanos = spawnNanos == 0.0 ? spawn : std::min(spawnNanos, spawn);
+            return nanos;
+        }));
+        results.push_back({"Repopulate", population, 1, repopulateNanos});
+        results.push_back({"SpawnCreature (queued)", population, churn, spawnNanos / churn});
+
+        results.push_back(measure("SpawnCreature", population, churn, [&]() {
+            auto start = Clock::now();
+            for (int k = 0; k < churn; ++k) {
+                aquarium.SpawnCreature(AquariumCreatureType::NPCreature);
+            }
+            double nanos = nanosSince(start);
+            for (int k = 0; k < churn; ++k) {
+                aquarium.removeCreature(aquarium.getCreatureAt(aquarium.getCreatureCount() - 1)->getHandle());
+            }
+            return nanos;
+        }));
+    }
+}
+
+// Sprite spawn latency and the bytes the sprites hold, against the
+// per-creature copies the atlas replaced: those copied two RGBA images
+// (normal and mirrored) per spawn and uploaded both. Only the CPU copies can
+// be timed headless; their bytes count the CPU buffers and the textures.
+void runSprites(const BenchOptions& options, std::vector<SpriteResult>& results) {
+    std::cerr << "sprites " << options.spawns << std::endl;
+    auto sprites = std::make_shared<AquariumSpriteManager>();
+    const SpriteAtlas& atlas = *sprites->GetAtlas();
+    const AquariumCreatureType types[] = {
+        AquariumCreatureType::NPCreature, AquariumCreatureType::ZigZagFish, AquariumCreatureType::BiggerFish,
+        AquariumCreatureType::BlueFish, AquariumCreatureType::Shark,
+    };
+    const int typeCount = (int)(sizeof(types) / sizeof(types[0]));
+    const int spawns = options.spawns;
+
+    std::vector<std::vector<unsigned char>> prototypes;
+    for (AquariumCreatureType type : types) {
+        const SpriteAtlas::Region& r = atlas.getRegion((int)type);
+        prototypes.emplace_back((size_t)r.width * r.height * 4, (unsigned char)0xff);
+    }
+    std::vector<std::vector<unsigned char>> copies;
+    copies.reserve(2 * spawns);
+    size_t copiedBytes = 0;
+    MicroResult deep = measure("deep copy", spawns, spawns, [&]() {
+        copies.clear();
+        copiedBytes = 0;
+        auto start = Clock::now();
+        for (int k = 0; k < spawns; ++k) {
+            const std::vector<unsigned char>& image = prototypes[k % typeCount];
+            copies.push_back(image);
+            copies.push_back(image);
+            copiedBytes += 2 * image.size();
+        }
+        return nanosSince(start);
+    });
+    results.push_back({deep.name, spawns, deep.nsPerOp, 2 * copiedBytes});
+
+    std::vector<std::shared_ptr<GameSprite>> held;
+    held.reserve(spawns);
+    MicroResult shared = measure("atlas", spawns, spawns, [&]() {
+        held.clear();
+        auto start = Clock::now();
+        for (int k = 0; k < spawns; ++k) {
+            held.push_back(sprites->GetSprite(types[k % typeCount]));
+        }
+        return nanosSince(start);
+    });
+    results.push_back({shared.name, spawns, shared.nsPerOp, atlas.getByteSize() + spawns * sizeof(GameSprite)});
+}
+
+std::vector<AquariumLevelSpec> loadLevels(const BenchOptions& options) {
+    std::vector<AquariumLevelSpec> levels;
+    std::string error;
+    if (!LoadLevelPack(options.levels, levels, error)) {
+        std::cerr << "level pack: " << error << ", using the built-in campaign" << std::endl;
+        ParseLevelPack(DefaultLevelPack(), levels, error);
+    }
+    return levels;
+}
+
+void runPlaythroughs(const BenchOptions& options, std::vector<Playthrough>& results) {
+    std::vector<AquariumLevelSpec> levels = loadLevels(options);
+    auto sprites = std::make_shared<AquariumSpriteManager>();
+    for (int run = 0; run < options.playthroughs; ++run) {
+        const uint64_t seed = run + 1;
+        auto aquarium = std::make_shared<Aquarium>(ofGetWidth(), ofGetHeight(), sprites, seed);
+        auto player = std::make_shared<PlayerCreature>(ofGetWidth() / 2 - 50, ofGetHeight() / 2 - 50, 3, sprites->GetSprite(AquariumCreatureType::NPCreature));
+        player->increasePower(1);
+        player->setDirection(0, 0);
+        player->setBounds(ofGetWidth() - 20, ofGetHeight() - 20);
+        aquarium->setLevels(BuildAquariumLevels(levels));
+        aquarium->Repopulate();
+        AquariumGameScene scene(player, aquarium, GameSceneKindToString(GameSceneKind::AQUARIUM_GAME));
+
+        Playthrough result{seed, 0, "frame limit", 0, 0.0};
+        auto start = Clock::now();
+        for (; result.frames < options.frames; ) {
+            steerPlayer(*aquarium, *player);
+            scene.Update();
+            ++result.frames;
+            scene.GetEvents().clear();
+            if (scene.IsGameOver()) { result.outcome = "game over"; break; }
+            if (aquarium->getCurrentLevel() >= aquarium->getLevelCount()) { result.outcome = "victory"; break; }
+        }
+        result.seconds = nanosSince(start) / 1e9;
+        result.score = player->getScore();
+        results.push_back(result);
+    }
+}
+
+void writeJson(std::ostream& out, const std::vector<MicroResult>& micro, const std::vector<SpriteResult>& spriteResults,
+               const std::vector<Playthrough>& playthroughs) {
+    out << "{\n  \"seed\": " << kBenchSeed << ",\n  \"micro\": [";
+    for (size_t i = 0; i < micro.size(); ++i) {
+        const MicroResult& r = micro[i];
+        out << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\", \"population\": " << r.population
+            << ", \"ops\": " << r.ops << ", \"ns_per_op\": " << r.nsPerOp << "}";
+    }
+    out << "\n  ],\n  \"sprites\": [";
+    for (size_t i = 0; i < spriteResults.size(); ++i) {
+        const SpriteResult& r = spriteResults[i];
+        out << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\", \"spawns\": " << r.spawns
+            << ", \"ns_per_spawn\": " << r.nsPerSpawn << ", \"bytes_held\": " << r.bytesHeld << "}";
+    }
+    out << "\n  ],\n  \"playthroughs\": [";
+    for (size_t i = 0; i < playthroughs.size(); ++i) {
+        const Playthrough& p = playthroughs[i];
+        out << (i ? ",\n" : "\n") << "    {\"seed\": " << p.seed << ", \"frames\": " << p.frames
+            << ", \"outcome\": \"" << p.outcome << "\", \"score\": " << p.score
+            << ", \"seconds\": " << p.seconds << ", \"ticks_per_sec\": " << (p.seconds > 0 ? p.frames / p.seconds : 0.0) << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options = parseArgs(argc, argv);
+    ofSetLogLevel(OF_LOG_ERROR);
+
+    std::vector<MicroResult> micro;
+    std::vector<SpriteResult> spriteResults;
+    std::vector<Playthrough> playthroughs;
+    runMicro(options, micro);
+    runSprites(options, spriteResults);
+    runPlaythroughs(options, playthroughs);
+
+    if (options.out.empty()) {
+        writeJson(std::cout, micro, spriteResults, playthroughs);
+        return 0;
+    }
+    std::ofstream file(options.out);
+    writeJson(file, micro, spriteResults, playthroughs);
+    if (!file) {
+        std::cerr << "could not write " << options.out << std::endl;
+        return 1;
+    }
+    std::cerr << "results: " << options.out << std::endl;
+    return 0;
+}
@@ -0,0 +1,405 @@
+// Headless simulation runner: steps the aquarium game scene without a window
+// or GL context, as fast as the CPU allows. Built with headless/Makefile.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "Aquarium.h"
+#include "LevelLoader.h"
+#include "JobSystem.h"
+#include "TankHost.h"
+#include "Profiler.h"
+#include "ScriptedPlayer.h"
+
+// Every heap allocation in the process goes through here, so --check-allocs
+// can tell whether a tick allocated.
+static std::atomic<long long> g_allocations{0};
+
+// GCC inlines these into callers and then sees free() on memory from
+// ::operator new, which it cannot tell came from malloc here.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void* operator new(std::size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+struct RunOptions {
+    int frames = 3600;
+    uint64_t seed = 1;
+    bool checkAllocs = false;
+    std::string levels = "bin/data/settings.xml";
+    int spawnBudget = 4;
+    int threads = 1;
+    bool scaling = false;
+    int creatures = 50000;
+    int tanks = 0;
+    std::string profile; // Chrome trace output path, empty = profiler off
+    ofLogLevel logLevel = OF_LOG_ERROR; // no sound players here, skip the warnings about it
+};
+
+// The runtime log level; messages below AQUARIUM_LOG_LEVEL are compiled out
+// whatever this says (build with CXXFLAGS="-O2 -DNDEBUG" in the environment to
+// drop verbose and notice, and compare frames/sec and worst tick).
+bool parseLogLevel(const char* name, ofLogLevel& level) {
+    const std::pair<const char*, ofLogLevel> names[] = {
+        {"verbose", OF_LOG_VERBOSE}, {"notice", OF_LOG_NOTICE}, {"warning", OF_LOG_WARNING},
+        {"error", OF_LOG_ERROR}, {"silent", OF_LOG_SILENT},
+    };
+    for (const auto& entry : names) {
+        if (std::strcmp(name, entry.first) == 0) {
+            level = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+RunOptions parseArgs(int argc, char** argv) {
+    RunOptions options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--check-allocs") == 0) {
+            options.checkAllocs = true;
+            continue;
+        }
+        if (std::strcmp(argv[i], "--scaling") == 0) {
+            options.scaling = true;
+            options.threads = std::max(options.threads, (int)std::thread::hardware_concurrency());
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "missing value for " << argv[i] << std::endl;
+            break;
+        }
+        if (std::strcmp(argv[i], "--frames") == 0) {
+            options.frames = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--levels") == 0) {
+            options.levels = argv[++i];
+        } else if (std::strcmp(argv[i], "--spawn-budget") == 0) {
+            options.spawnBudget = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            options.threads = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--profile") == 0) {
+            options.profile = argv[++i];
+        } else if (std::strcmp(argv[i], "--tanks") == 0) {
+            options.tanks = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--creatures") == 0) {
+            options.creatures = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--log-level") == 0) {
+            if (!parseLogLevel(argv[++i], options.logLevel)) {
+                std::cerr << "unknown log level " << argv[i] << std::endl;
+            }
+        } else {
+            std::cerr << "unknown option " << argv[i] << std::endl;
+            ++i;
+        }
+    }
+    return options;
+}
+
+// The campaign from --levels, or the built-in one if that cannot be read.
+std::vector<AquariumLevelSpec> loadLevels(const RunOptions& options) {
+    std::vector<AquariumLevelSpec> levels;
+    std::string error;
+    auto start = std::chrono::steady_clock::now();
+    if (!LoadLevelPack(options.levels, levels, error)) {
+        std::cerr << "level pack: " << error << ", using the built-in campaign" << std::endl;
+        ParseLevelPack(DefaultLevelPack(), levels, error);
+    }
+    double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "levels:     " << levels.size() << " loaded in " << micros << " us" << std::endl;
+    return levels;
+}
+
+// Steady-state check: a predator level with no player, so fish are eaten and
+// respawned every few ticks. After a warm-up that grows the pools and scratch
+// buffers, ticking the tank must not touch the heap. Power-ups are collected
+// as they appear, like the player would, so the tank does not keep growing.
+int checkAllocations(const RunOptions& options) {
+    auto spriteManager = std::make_shared<AquariumSpriteManager>();
+    Aquarium aquarium(ofGetWidth(), ofGetHeight(), spriteManager, options.seed);
+    JobSystem jobs(options.threads);
+    aquarium.setJobSystem(&jobs);
+    std::vector<AquariumLevelSpec> levels = loadLevels(options);
+    AquariumLevelSpec predators = levels[std::min<size_t>(4, levels.size() - 1)];
+    predators.targetScore = 1000000;
+    aquarium.setLevels(BuildAquariumLevels({predators}));
+    aquarium.Repopulate();
+
+    auto tick = [&aquarium]() {
+        aquarium.update();
+        for (int i = aquarium.getCreatureCount() - 1; i >= 0; --i) {
+            if (aquarium.getCreatureAt(i)->getValue() == -999) {
+                aquarium.removeCreature(aquarium.getCreatureAt(i));
+            }
+        }
+    };
+    for (int i = 0; i < SecondsToTicks(30.0f); ++i) {
+        tick();
+    }
+    long long before = g_allocations.load();
+    for (int i = 0; i < options.frames; ++i) {
+        tick();
+    }
+    long long allocations = g_allocations.load() - before;
+
+    // the scene's event path: publish past capacity, then drain to a subscriber
+    EventQueue events;
+    long long delivered = 0;
+    events.subscribe([&delivered](const GameEvent& event) { delivered += event.value; });
+    before = g_allocations.load();
+    for (int frame = 0; frame < 100; ++frame) {
+        for (int i = 0; i < EventQueue::kCapacity + 16; ++i) {
+            events.publish(GameEvent(GameEventType::CREATURE_REMOVED, CreatureHandle(), CreatureHandle(), 1));
+        }
+        events.dispatch();
+    }
+    long long eventAllocations = g_allocations.load() - before;
+
+    std::cout << "ticks:       " << options.frames << std::endl;
+    std::cout << "allocations: " << allocations << std::endl;
+    std::cout << "pooled:      " << aquarium.getPooledCount() << std::endl;
+    std::cout << "events:      " << delivered << " delivered, " << events.getDroppedCount()
+              << " dropped, " << eventAllocations << " allocations" << std::endl;
+    return allocations == 0 && eventAllocations == 0 ? 0 : 1;
+}
+
+// Bit pattern of every creature position, to compare runs exactly.
+uint64_t tankChecksum(Aquarium& aquarium) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (int i = 0; i < aquarium.getCreatureCount(); ++i) {
+        float position[2] = {aquarium.getCreatureAt(i)->getX(), aquarium.getCreatureAt(i)->getY()};
+        uint32_t bits[2];
+        std::memcpy(bits, position, sizeof(bits));
+        for (uint32_t word : bits) {
+            hash = (hash ^ word) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+// Tank update throughput for 1..--threads threads on one large tank of plain
+// fish, sized for a few fish per grid cell. Every thread count must end on
+// the same checksum: the parallel passes may not change the simulation.
+int runScaling(const RunOptions& options) {
+    const int side = (int)std::sqrt(options.creatures / 4.0) * 64;
+    AquariumLevelSpec spec;
+    spec.targetScore = 1000000;
+    spec.population.emplace_back(AquariumCreatureType::NPCreature, options.creatures);
+
+    std::cout << "creatures:  " << options.creatures << " in a " << side << "x" << side << " tank, "
+              << options.frames << " ticks" << std::endl;
+    double baseline = 0.0;
+    uint64_t expected = 0;
+    bool identical = true;
+    for (int threads = 1; threads <= options.threads; ++threads) {
+        auto spriteManager = std::make_shared<AquariumSpriteManager>();
+        Aquarium aquarium(side, side, spriteManager, options.seed);
+        JobSystem jobs(threads);
+        aquarium.setJobSystem(&jobs);
+        aquarium.setSpawnBudget(0);
+        aquarium.setLevels(BuildAquariumLevels({spec}));
+        aquarium.update(); // spawns the whole tank
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < options.frames; ++i) {
+            aquarium.update();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double ticksPerSecond = seconds > 0 ? options.frames / seconds : 0.0;
+        uint64_t checksum = tankChecksum(aquarium);
+        if (threads == 1) {
+            baseline = ticksPerSecond;
+            expected = checksum;
+        }
+        identical = identical && checksum == expected;
+        std::cout << "threads " << threads << ": " << ticksPerSecond << " ticks/sec, speedup "
+                  << (baseline > 0 ? ticksPerSecond / baseline : 0.0) << "x, checksum " << std::hex << checksum
+                  << std::dec << (checksum == expected ? "" : " MISMATCH")
+                  << (threads > (int)std::thread::hardware_concurrency() ? " (oversubscribed)" : "") << std::endl;
+    }
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    return identical ? 0 : 1;
+}
+
+// --tanks N: N independent sessions (seeds seed .. seed + N - 1), each steered
+// by the scripted player, stepped together on --threads threads until they
+// all finish or hit --frames.
+struct TankRun {
+    int tanks = 0;
+    int won = 0;
+    int lost = 0;
+    long long tankTicks = 0;
+    long long score = 0;
+    double seconds = 0.0;
+    double creatureTicksPerSecond = 0.0;
+};
+
+TankRun stepTanks(const RunOptions& options, const std::vector<AquariumLevelSpec>& levels, int threads) {
+    TankHost host(ofGetWidth(), ofGetHeight(), std::make_shared<AquariumSpriteManager>());
+    host.setController(steerPlayer);
+    for (int i = 0; i < options.tanks; ++i) {
+        host.addTank(options.seed + i, levels);
+    }
+    JobSystem jobs(threads);
+
+    auto start = std::chrono::steady_clock::now();
+    int ticks = 0;
+    while (ticks < options.frames) {
+        int batch = std::min(kSimulationHz, options.frames - ticks);
+        ticks += batch;
+        if (host.step(batch, &jobs) == 0) break;
+    }
+    TankRun run;
+    run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    run.tanks = host.getTankCount();
+    for (int i = 0; i < host.getTankCount(); ++i) {
+        const TankHost::Tank& tank = host.getTank(i);
+        run.won += tank.won ? 1 : 0;
+        run.lost += tank.finished && !tank.won ? 1 : 0;
+        run.tankTicks += tank.ticks;
+        run.score += tank.player->getScore();
+    }
+    run.creatureTicksPerSecond = run.seconds > 0 ? host.getCreatureTicks() / run.seconds : 0.0;
+    return run;
+}
+
+int runTanks(const RunOptions& options) {
+    TankRun run = stepTanks(options, loadLevels(options), options.threads);
+    std::cout << "tanks:      " << run.tanks << " on " << options.threads << " threads" << std::endl;
+    std::cout << "outcome:    " << run.won << " won, " << run.lost << " lost, "
+              << run.tanks - run.won - run.lost << " still running" << std::endl;
+    std::cout << "tank ticks: " << run.tankTicks << " (total score " << run.score << ")" << std::endl;
+    std::cout << "seconds:    " << run.seconds << std::endl;
+    std::cout << "creature-ticks/sec: " << run.creatureTicksPerSecond << std::endl;
+    return 0;
+}
+
+// --tanks N --scaling: the same sessions on 1 .. --threads threads. Every
+// run must play out the same.
+int runTankScaling(const RunOptions& options) {
+    std::vector<AquariumLevelSpec> levels = loadLevels(options);
+    std::cout << "tanks:      " << options.tanks << ", up to " << options.frames << " ticks" << std::endl;
+    TankRun baseline;
+    bool identical = true;
+    for (int threads = 1; threads <= options.threads; ++threads) {
+        TankRun run = stepTanks(options, levels, threads);
+        if (threads == 1) {
+            baseline = run;
+        }
+        bool same = run.tankTicks == baseline.tankTicks && run.score == baseline.score;
+        identical = identical && same;
+        std::cout << "threads " << threads << ": " << run.creatureTicksPerSecond << " creature-ticks/sec, speedup "
+                  << (baseline.creatureTicksPerSecond > 0 ? run.creatureTicksPerSecond / baseline.creatureTicksPerSecond : 0.0)
+                  << "x, total score " << run.score << (same ? "" : " MISMATCH")
+                  << (threads > (int)std::thread::hardware_concurrency() ? " (oversubscribed)" : "") << std::endl;
+    }
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    return identical ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RunOptions options = parseArgs(argc, argv);
+    ofSetLogLevel(options.logLevel);
+    if (options.checkAllocs) {
+        return checkAllocations(options);
+    }
+    if (options.scaling) {
+        return options.tanks > 0 ? runTankScaling(options) : runScaling(options);
+    }
+    if (options.tanks > 0) {
+        return runTanks(options);
+    }
+
+    const int width = ofGetWidth();
+    const int height = ofGetHeight();
+    auto spriteManager = std::make_shared<AquariumSpriteManager>();
+    auto aquarium = std::make_shared<Aquarium>(width, height, spriteManager, options.seed);
+    JobSystem jobs(options.threads);
+    aquarium->setJobSystem(&jobs);
+    auto player = std::make_shared<PlayerCreature>(width / 2 - 50, height / 2 - 50, 3, spriteManager->GetSprite(AquariumCreatureType::NPCreature));
+    player->increasePower(1);
+    player->setDirection(0, 0);
+    player->setBounds(width - 20, height - 20);
+
+    aquarium->setSpawnBudget(options.spawnBudget);
+    aquarium->setLevels(BuildAquariumLevels(loadLevels(options)));
+    aquarium->Repopulate();
+
+    AquariumGameScene scene(player, aquarium, GameSceneKindToString(GameSceneKind::AQUARIUM_GAME));
+    int eventCounts[kGameEventTypeCount] = {};
+    scene.GetEvents().subscribe([&eventCounts](const GameEvent& event) { ++eventCounts[(int)event.type]; });
+    Profiler::setEnabled(!options.profile.empty());
+
+    auto start = std::chrono::steady_clock::now();
+    int frame = 0;
+    const char* outcome = "frame limit";
+    double worstTick = 0.0;
+    for (; frame < options.frames; ++frame) {
+        Profiler::beginFrame();
+        steerPlayer(*aquarium, *player);
+        auto tickStart = std::chrono::steady_clock::now();
+        scene.Update();
+        worstTick = std::max(worstTick, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tickStart).count());
+        scene.GetEvents().dispatch();
+        if (scene.IsGameOver()) { outcome = "game over"; ++frame; break; }
+        if (aquarium->getCurrentLevel() >= aquarium->getLevelCount()) { outcome = "victory"; ++frame; break; }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "frames:     " << frame << " (" << outcome << ")" << std::endl;
+    std::cout << "seconds:    " << seconds << std::endl;
+    std::cout << "frames/sec: " << (seconds > 0 ? frame / seconds : 0.0) << std::endl;
+    std::cout << "worst tick: " << worstTick << " us" << std::endl;
+    std::cout << "score:      " << player->getScore() << std::endl;
+    std::cout << "lives:      " << player->getLives() << std::endl;
+    std::cout << "level:      " << aquarium->getCurrentLevel() << std::endl;
+    std::cout << "creatures:  " << aquarium->getCreatureCount() << std::endl;
+    std::cout << "events:     " << eventCounts[(int)GameEventType::CREATURE_REMOVED] << " eaten, "
+              << eventCounts[(int)GameEventType::POWER_UP_COLLECTED] << " power-ups, "
+              << eventCounts[(int)GameEventType::PLAYER_HIT] << " hits, "
+              << eventCounts[(int)GameEventType::NEW_LEVEL] << " level-ups" << std::endl;
+
+    if (Profiler::isEnabled()) {
+        std::vector<Profiler::ScopeStats> stats;
+        Profiler::getStats(stats);
+        std::cout << "profile (last " << Profiler::kHistoryFrames << " ticks, ms): min / avg / p99" << std::endl;
+        for (const Profiler::ScopeStats& scope : stats) {
+            std::cout << "  " << scope.name << ": " << scope.minMs << " / " << scope.avgMs << " / " << scope.p99Ms << std::endl;
+        }
+        if (!Profiler::writeChromeTrace(options.profile)) {
+            std::cerr << "could not write " << options.profile << std::endl;
+            return 1;
+        }
+        std::cout << "trace:      " << options.profile << std::endl;
+    }
+    return 0;
+}
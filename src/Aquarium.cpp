@@ -1,6 +1,17 @@
 #include "Aquarium.h"
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include "Core.h"
+#include "MovementKernel.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#ifndef AQUARIUM_HEADLESS
+#include "AssetLoader.h"
+#endif
+
+// rows per job when the linear movement pass is split across threads
+static constexpr int kMoveGrain = 2048;
 
 
 string AquariumCreatureTypeToString(AquariumCreatureType t){
@@ -28,20 +39,45 @@ string AquariumCreatureTypeToString(AquariumCreatureType t){
     }
 }
 
+bool AquariumCreatureTypeFromString(const std::string& name, AquariumCreatureType& type){
+    static const std::pair<const char*, AquariumCreatureType> names[] = {
+        {"NPCreature", AquariumCreatureType::NPCreature},
+        {"BiggerFish", AquariumCreatureType::BiggerFish},
+        {"PowerUp", AquariumCreatureType::PowerUp},
+        {"ZigZagFish", AquariumCreatureType::ZigZagFish},
+        {"LurkerFish", AquariumCreatureType::LurkerFish},
+        {"BlueFish", AquariumCreatureType::BlueFish},
+        {"RedFish", AquariumCreatureType::RedFish},
+        {"VioletFish", AquariumCreatureType::VioletFish},
+        {"Shark", AquariumCreatureType::Shark},
+    };
+    for (const auto& entry : names) {
+        if (name == entry.first) {
+            type = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool isPredatorType(AquariumCreatureType t){
+    return t == AquariumCreatureType::BiggerFish || t == AquariumCreatureType::Shark;
+}
+
 // PlayerCreature Implementation
 PlayerCreature::PlayerCreature(float x, float y, int speed, std::shared_ptr<GameSprite> sprite)
-: Creature(x, y, speed, 10.0f, 1, sprite) {}
+: Creature(x, y, speed, 10.0f, 1, sprite), m_prevX(x), m_prevY(y) {}
 
 
 void PlayerCreature::setDirection(float dx, float dy) {
-    m_dx = dx;
-    m_dy = dy;
+    dirX() = dx;
+    dirY() = dy;
     normalize();
 }
 
 void PlayerCreature::move() {
-    m_x += m_dx * m_speed * m_speedMultiplier;
-    m_y += m_dy * m_speed * m_speedMultiplier;
+    posX() += dirX() * speed() * m_speedMultiplier * kTickSpeedScale;
+    posY() += dirY() * speed() * m_speedMultiplier * kTickSpeedScale;
     this->bounce();
 }
 
@@ -52,200 +88,347 @@ void PlayerCreature::reduceDamageDebounce() {
 }
 
 void PlayerCreature::update() {
+    m_prevX = posX();
+    m_prevY = posY();
     this->reduceDamageDebounce();
     this->move();
 }
 
 
 void PlayerCreature::draw() const {
-    ofLogVerbose() << "PlayerCreature at (" << m_x << ", " << m_y << ") with speed " << m_speed << std::endl;
+    AQ_LOG_VERBOSE("PlayerCreature at (" << posX() << ", " << posY() << ") with speed " << speed());
 
     // Scale based on power level 
     float scale = 1.0f + m_power * 0.05f; // 5% growth per power level
 
-    if (this->m_damage_debounce > 0) {
-        ofSetColor(ofColor::red); // Flash red if hit
-    } else {
-        ofSetColor(m_tintColor); // Use tint color (set on level-up)
-    }
+    // Flash red if hit, otherwise the tint color set on level-up
+    const ofColor& tint = this->m_damage_debounce > 0 ? ofColor::red : m_tintColor;
 
     if (m_sprite) {
         ofPushMatrix();
-        ofTranslate(m_x, m_y);
+        ofTranslate(m_prevX + (posX() - m_prevX) * m_renderAlpha,
+                    m_prevY + (posY() - m_prevY) * m_renderAlpha);
         ofScale(scale, scale);
-        m_sprite->draw(0, 0); 
+        m_sprite->draw(0, 0, m_sprite->isFlipped(), tint); // flipped by the arrow keys
         ofPopMatrix();
     }
-
-    ofSetColor(ofColor::white); // Reset color
 }
 
 void PlayerCreature::changeSpeed(int speed) {
-    m_speed = speed;
+    this->speed() = speed;
 }
 
 void PlayerCreature::loseLife(int debounce) {
     if (m_damage_debounce <= 0) {
         if (m_lives > 0) this->m_lives -= 1;
-        m_damage_debounce = debounce; // Set debounce frames
-        ofLogNotice() << "Player lost a life! Lives remaining: " << m_lives << std::endl;
+        m_damage_debounce = debounce; // Set debounce ticks
+        AQ_LOG_NOTICE("Player lost a life! Lives remaining: " << m_lives);
     }
     // If in debounce period, do nothing
     if (m_damage_debounce > 0) {
-        ofLogVerbose() << "Player is in damage debounce period. Frames left: " << m_damage_debounce << std::endl;
+        AQ_LOG_VERBOSE("Player is in damage debounce period. Ticks left: " << m_damage_debounce);
     }
 }
 
 // NPCreature Implementation
-NPCreature::NPCreature(float x, float y, int speed, std::shared_ptr<GameSprite> sprite)
-: Creature(x, y, speed, 22.f, 1, sprite) {
+NPCreature::NPCreature(float x, float y, int speed, std::shared_ptr<GameSprite> sprite, RandomGenerator& rng)
+: Creature(x, y, speed, 22.f, 1, sprite), m_rng(&rng) {
+    NPCreature::reset(x, y, speed);
+}
+
+void NPCreature::reset(float x, float y, int speed) {
+    this->resetState(x, y, speed, 22.f, 1);
     if (speed < 1) speed = 1;
     if (speed > 2) speed = 2;
-    m_speed = speed;
+    this->speed() = speed;
 
-    m_dx = (rand() % 3 - 1); // -1, 0 o 1
-    m_dy = (rand() % 3 - 1);
-    if (m_dx == 0 && m_dy == 0) { m_dx = 1; m_dy = 0; } // evita quedar quieto
+    dirX() = (m_rng->nextInt(3) - 1); // -1, 0 o 1
+    dirY() = (m_rng->nextInt(3) - 1);
+    if (dirX() == 0 && dirY() == 0) { dirX() = 1; dirY() = 0; } // evita quedar quieto
     normalize();
 
     m_creatureType = AquariumCreatureType::NPCreature;
 }
 
+// Scalar reference for moveLinearCreatures (MovementKernel), which
+// must stay in sync with it. Facing is taken from dirX() at draw time.
 void NPCreature::move() {
-   
-    m_x += m_dx * m_speed;
-    m_y += m_dy * m_speed;
-    if(m_dx < 0 ){
-        this->m_sprite->setFlipped(true);
-    }else {
-        this->m_sprite->setFlipped(false);
-    }
+    float scale = linearSpeedScale() * kTickSpeedScale;
+    posX() += dirX() * (speed() * scale);
+    posY() += dirY() * (speed() * scale);
     bounce();
 }
 
 void NPCreature::draw() const {
-    ofLogVerbose() << "NPCreature at (" << m_x << ", " << m_y << ") with speed " << m_speed << std::endl;
-    ofSetColor(ofColor::white);
+    AQ_LOG_VERBOSE("NPCreature at (" << posX() << ", " << posY() << ") with speed " << speed());
     if (m_sprite) {
-        m_sprite->draw(m_x, m_y);
+        m_sprite->draw(posX(), posY(), dirX() < 0);
     }
 }
 
 
-BiggerFish::BiggerFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite)
-: NPCreature(x, y, speed, sprite) {
-     if (speed < 1) speed = 1;
+BiggerFish::BiggerFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite, RandomGenerator& rng)
+: NPCreature(x, y, speed, sprite, rng) {
+    this->initBiggerFish(speed);
+}
+
+void BiggerFish::reset(float x, float y, int speed) {
+    NPCreature::reset(x, y, speed);
+    this->initBiggerFish(speed);
+}
+
+void BiggerFish::initBiggerFish(int speed) {
+    if (speed < 1) speed = 1;
     if (speed > 3) speed = 3;  // más lento
-    m_speed = speed;
+    this->speed() = speed;
 
-    m_dx = (rand() % 3 - 1);
-    m_dy = (rand() % 3 - 1);
-    if (m_dx == 0 && m_dy == 0) { m_dx = -1; m_dy = 0; }
+    dirX() = (m_rng->nextInt(3) - 1);
+    dirY() = (m_rng->nextInt(3) - 1);
+    if (dirX() == 0 && dirY() == 0) { dirX() = -1; dirY() = 0; }
     normalize();
 
     setCollisionRadius(50); // Bigger fish have a larger collision radius
-    m_value = 7; // Bigger fish have a higher value (increased from 5)
+    value() = 7; // Bigger fish have a higher value (increased from 5)
     m_creatureType = AquariumCreatureType::BiggerFish;
 }
 
 void BiggerFish::move() {
     // Bigger fish might move slower or have different logic
-    m_x += m_dx * (m_speed * 0.5); // Moves at half speed
-    m_y += m_dy * (m_speed * 0.5);
-    if(m_dx < 0 ){
-        this->m_sprite->setFlipped(true);
-    }else {
-        this->m_sprite->setFlipped(false);
-    }
-
-    bounce();
+    NPCreature::move(); // linearSpeedScale() makes it half speed
 }
 
 void BiggerFish::draw() const {
-    ofLogVerbose() << "BiggerFish at (" << m_x << ", " << m_y << ") with speed " << m_speed << std::endl;
-    this->m_sprite->draw(this->m_x, this->m_y);
+    AQ_LOG_VERBOSE("BiggerFish at (" << posX() << ", " << posY() << ") with speed " << speed());
+    this->m_sprite->draw(posX(), posY(), dirX() < 0);
 }
 
 
 // AquariumSpriteManager
+// Atlas entries are indexed by AquariumCreatureType.
+static std::vector<SpriteAtlasEntry> AquariumAtlasEntries() {
+    return {
+        {"base-fish.png", 70, 70},      // NPCreature
+        {"bigger-fish.png", 120, 120},  // BiggerFish
+        {"base-fish.png", 50, 50},      // PowerUp
+        {"zigzag-fish.png", 70, 70},    // ZigZagFish
+        {"lurker-fish.png", 70, 70},    // LurkerFish
+        {"Blue-fish.png", 70, 70},      // BlueFish
+        {"Red-fish.png", 70, 70},       // RedFish
+        {"Violet-fish.png", 70, 70},    // VioletFish
+        {"shark.png", 180, 180},        // Shark
+    };
+}
+
 AquariumSpriteManager::AquariumSpriteManager(){
-    this->m_npc_fish = std::make_shared<GameSprite>("base-fish.png", 70,70);
-    this->m_big_fish = std::make_shared<GameSprite>("bigger-fish.png", 120, 120);
-    this->m_power_up = std::make_shared<GameSprite>("base-fish.png", 50, 50);
-    this->m_power_up->setTintColor(ofColor::yellow);
-    this->m_zigzag_fish = std::make_shared<GameSprite>("zigzag-fish.png", 70, 70);
-    this->m_lurker_fish = std::make_shared<GameSprite>("lurker-fish.png", 70, 70);
-    this->m_blue_fish = std::make_shared<GameSprite>("Blue-fish.png", 70, 70);
-    this->m_red_fish = std::make_shared<GameSprite>("Red-fish.png", 70, 70);
-    this->m_violet_fish = std::make_shared<GameSprite>("Violet-fish.png", 70, 70);
-    this->m_shark = std::make_shared<GameSprite>("shark.png", 180, 180); 
-}
-
-std::shared_ptr<GameSprite> AquariumSpriteManager::GetSprite(AquariumCreatureType t){
-    switch(t){
-        case AquariumCreatureType::BiggerFish:
-            return std::make_shared<GameSprite>(*this->m_big_fish);
-            
-        case AquariumCreatureType::NPCreature:
-            return std::make_shared<GameSprite>(*this->m_npc_fish);
-            
-        case AquariumCreatureType::PowerUp:
-            return std::make_shared<GameSprite>(*this->m_power_up);
-            
-        case AquariumCreatureType::ZigZagFish:
-            return std::make_shared<GameSprite>(*this->m_zigzag_fish);
-            
-        case AquariumCreatureType::LurkerFish:
-            return std::make_shared<GameSprite>(*this->m_lurker_fish);
-            
-        case AquariumCreatureType::BlueFish:
-            return std::make_shared<GameSprite>(*this->m_blue_fish);
-            
-        case AquariumCreatureType::RedFish:
-            return std::make_shared<GameSprite>(*this->m_red_fish);
-            
-        case AquariumCreatureType::VioletFish:
-            return std::make_shared<GameSprite>(*this->m_violet_fish);
-            
-        case AquariumCreatureType::Shark:
-            return std::make_shared<GameSprite>(*this->m_shark);
-            
-        default:
-            return nullptr;
+    std::vector<SpriteAtlasEntry> entries = AquariumAtlasEntries();
+    this->m_atlas = std::make_shared<SpriteAtlas>(entries);
+    ofLogNotice() << "Sprite atlas: " << entries.size() << " regions, " << this->m_atlas->getByteSize() / 1024 << " KB";
+}
+
+#ifndef AQUARIUM_HEADLESS
+AquariumSpriteManager::AquariumSpriteManager(AssetLoader& loader){
+    std::vector<SpriteAtlasEntry> entries = AquariumAtlasEntries();
+    auto atlas = std::make_shared<SpriteAtlas>(entries, false);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        loader.addImage(entries[i].imagePath, entries[i].width, entries[i].height, [atlas, i](ofPixels& pixels) {
+            atlas->uploadRegion((int)i, pixels);
+        });
+    }
+    this->m_atlas = atlas;
+    ofLogNotice() << "Sprite atlas: " << entries.size() << " regions, " << this->m_atlas->getByteSize() / 1024 << " KB, loading";
+}
+#endif
+
+std::shared_ptr<GameSprite> AquariumSpriteManager::GetSprite(AquariumCreatureType t) const {
+    int region = static_cast<int>(t);
+    if (region < 0 || region >= this->m_atlas->getRegionCount()) {
+        return nullptr;
+    }
+    auto sprite = std::make_shared<GameSprite>(this->m_atlas, region);
+    if (t == AquariumCreatureType::PowerUp) {
+        sprite->setTintColor(ofColor::yellow);
+    }
+    return sprite;
+}
+
+
+// CreatureStore
+CreatureHandle CreatureStore::add(std::shared_ptr<NPCreature> creature, AquariumCreatureType creatureType) {
+    int slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slot = (int)m_slotGeneration.size();
+        m_slotGeneration.push_back(0);
+        m_slotRow.push_back(-1);
+        m_freeSlots.reserve(m_slotGeneration.size()); // freeing never allocates
+    }
+    int row = columns.push(creature->localState());
+    m_slotRow[slot] = row;
+    m_rowSlot.push_back(slot);
+    type.push_back(creatureType);
+    moveScale.push_back(creature->linearSpeedScale() * kTickSpeedScale);
+    prevX.push_back(columns.x[row]);
+    prevY.push_back(columns.y[row]);
+    CreatureHandle handle{slot, m_slotGeneration[slot]};
+    creature->bindStorage(&columns, row, handle);
+    owner.push_back(std::move(creature));
+    return handle;
+}
+
+void CreatureStore::releaseSlot(int slot) {
+    ++m_slotGeneration[slot];
+    m_slotRow[slot] = -1;
+    m_freeSlots.push_back(slot);
+}
+
+void CreatureStore::erase(int row) {
+    owner[row]->unbindStorage();
+    this->releaseSlot(m_rowSlot[row]);
+
+    int last = size() - 1;
+    columns.swapRemove(row);
+    if (row != last) {
+        type[row] = type[last];
+        moveScale[row] = moveScale[last];
+        prevX[row] = prevX[last];
+        prevY[row] = prevY[last];
+        owner[row] = std::move(owner[last]);
+        m_rowSlot[row] = m_rowSlot[last];
+        m_slotRow[m_rowSlot[row]] = row;
+        owner[row]->rebindSlot(row);
+    }
+    type.pop_back();
+    moveScale.pop_back();
+    prevX.pop_back();
+    prevY.pop_back();
+    owner.pop_back();
+    m_rowSlot.pop_back();
+}
+
+void CreatureStore::clear() {
+    for (auto& creature : owner) {
+        creature->unbindStorage();
+    }
+    for (int slot : m_rowSlot) {
+        this->releaseSlot(slot);
+    }
+    columns.clear();
+    type.clear();
+    moveScale.clear();
+    prevX.clear();
+    prevY.clear();
+    owner.clear();
+    m_rowSlot.clear();
+}
+
+// CreaturePool
+void CreaturePool::track(AquariumCreatureType type) {
+    m_free[(int)type].reserve(++m_created[(int)type]);
+}
+
+void CreaturePool::release(AquariumCreatureType type, std::shared_ptr<NPCreature> creature) {
+    m_free[(int)type].push_back(std::move(creature));
+}
+
+std::shared_ptr<NPCreature> CreaturePool::acquire(AquariumCreatureType type) {
+    // an event may still hold a creature that was just removed; skip those
+    auto& free = m_free[(int)type];
+    for (int i = (int)free.size() - 1; i >= 0; --i) {
+        if (free[i].use_count() == 1) {
+            std::swap(free[i], free.back());
+            std::shared_ptr<NPCreature> creature = std::move(free.back());
+            free.pop_back();
+            return creature;
+        }
     }
+    return nullptr;
 }
 
+int CreaturePool::size() const {
+    int total = 0;
+    for (const auto& free : m_free) {
+        total += (int)free.size();
+    }
+    return total;
+}
 
 // Aquarium Implementation
-Aquarium::Aquarium(int width, int height, std::shared_ptr<AquariumSpriteManager> spriteManager)
-    : m_width(width), m_height(height) {
+Aquarium::Aquarium(int width, int height, std::shared_ptr<AquariumSpriteManager> spriteManager, uint64_t seed)
+    : m_width(width), m_height(height), m_rng(seed) {
         m_sprite_manager =  spriteManager;
     }
 
 
 
-void Aquarium::addCreature(std::shared_ptr<Creature> creature) {
+CreatureHandle Aquarium::addCreature(std::shared_ptr<NPCreature> creature) {
     creature->setBounds(m_width - 20, m_height - 20);
-    m_creatures.push_back(creature);
+    auto creatureType = creature->GetType();
+    m_gridDirty = true;
+    return m_store.add(std::move(creature), creatureType);
 }
 
 void Aquarium::addAquariumLevel(std::shared_ptr<AquariumLevel> level){
     if(level == nullptr){return;} // guard to not add noise
     this->m_aquariumlevels.push_back(level);
+    this->selectLevel();
+}
+
+void Aquarium::selectLevel(){
+    m_level = m_aquariumlevels.empty() ? nullptr : m_aquariumlevels[currentLevel % m_aquariumlevels.size()].get();
+}
+
+void Aquarium::setLevels(std::vector<std::shared_ptr<AquariumLevel>> levels){
+    if(levels.empty()){return;}
+    bool finished = !m_aquariumlevels.empty() && currentLevel >= (int)m_aquariumlevels.size();
+    m_aquariumlevels = std::move(levels);
+    int last = (int)m_aquariumlevels.size() - 1;
+    currentLevel = finished ? last + 1 : std::min(currentLevel, last);
+    selectLevel();
+    clearCreatures();
 }
 
 void Aquarium::update() {
-    for (auto& creature : m_creatures) {
-        creature->move();
+    AQ_PROFILE_SCOPE("Aquarium::update");
+    m_store.prevX = m_store.columns.x;
+    m_store.prevY = m_store.columns.y;
+
+    // creatures with their own logic go through move(), the rest are advanced
+    // in one linear pass over the state columns
+    {
+        AQ_PROFILE_SCOPE("Aquarium move");
+        for (int i = 0; i < m_store.size(); ++i) {
+            if (m_store.moveScale[i] == 0.0f) {
+                m_store.owner[i]->move();
+            }
+        }
+        if (m_jobs != nullptr) {
+            // rows are independent, so any split gives the same columns
+            m_jobs->parallelFor(m_store.size(), kMoveGrain, [this](int, int begin, int end) {
+                moveLinearCreatures(m_store.columns, m_store.moveScale, begin, end);
+            });
+        } else {
+            moveLinearCreatures(m_store.columns, m_store.moveScale, 0, m_store.size());
+        }
     }
     this->Repopulate();
+    this->spawnQueued();
+
+    // everything moved, re-bin the tank for this frame's collision queries
+    m_gridDirty = true;
+    this->refreshSpatialGrid();
+
+    // creature vs creature: predators eat smaller fish sharing the tank
+    this->detectCreatureContacts();
+    this->resolvePredation();
     
-    // ⚡ Power-Up spawning timer (every 20 seconds at 60fps = 1200 frames)
+    // ⚡ Power-Up spawning timer (every 20 seconds)
     m_powerUpTimer++;
-    if (m_powerUpTimer > 1200) {
+    if (m_powerUpTimer > SecondsToTicks(20.0f)) {
         this->SpawnCreature(AquariumCreatureType::PowerUp);
         m_powerUpTimer = 0;
-        ofLogNotice() << " Speed Power-Up spawned!";
+        AQ_LOG_NOTICE(" Speed Power-Up spawned!");
     }
     
     // ⏱ Power-Up active timer countdown
@@ -253,109 +436,291 @@ void Aquarium::update() {
         m_powerUpActiveTimer--;
         if (m_powerUpActiveTimer == 0) {
             m_speedMultiplier = 1.0f;
-            ofLogNotice() << "Speed Power-Up expired.";
+            AQ_LOG_NOTICE("Speed Power-Up expired.");
         }
     }
+
+    this->flushRemovals();
 }
 
 void Aquarium::draw() const {
-    for (const auto& creature : m_creatures) {
-        creature->draw();
+    AQ_PROFILE_SCOPE("Aquarium::draw");
+    if (!m_batchedDraw) {
+        for (const auto& creature : m_store.owner) {
+            creature->draw();
+        }
+        return;
     }
+
+    // every aquarium fish faces the way it swims, so the flip comes straight
+    // from the direction column
+    const SpriteAtlas* atlas = m_sprite_manager->GetAtlas().get();
+    const CreatureColumns& c = m_store.columns;
+    const float alpha = m_renderAlpha;
+    m_batch.begin();
+    for (int i = 0; i < m_store.size(); ++i) {
+        const Creature& creature = *m_store.owner[i];
+        const GameSprite* sprite = creature.getSprite().get();
+        if (sprite == nullptr) continue;
+        if (sprite->getAtlas() != atlas) {
+            creature.draw(); // not atlas art, draw on its own
+            continue;
+        }
+        float x = m_store.prevX[i] + (c.x[i] - m_store.prevX[i]) * alpha;
+        float y = m_store.prevY[i] + (c.y[i] - m_store.prevY[i]) * alpha;
+        m_batch.add(*atlas, sprite->getRegion(), x, y, creature.getDrawScale(), c.dx[i] < 0, sprite->getTintColor());
+    }
+    m_batch.draw(*atlas);
 }
 
 
 void Aquarium::removeCreature(std::shared_ptr<Creature> creature) {
-    auto it = std::find(m_creatures.begin(), m_creatures.end(), creature);
-    if (it != m_creatures.end()) {
-        ofLogVerbose() << "removing creature " << endl;
+    if (!creature) return;
+    this->removeCreature(creature->getHandle());
+}
+
+void Aquarium::removeCreature(CreatureHandle handle) {
+    int row = m_store.rowOf(handle);
+    if (row != -1) {
+        AQ_LOG_VERBOSE("removing creature ");
         
         // Don't consume power-ups from level population (they have value -999)
-        if (creature->getValue() != -999) {
-            int selectLvl = this->currentLevel % this->m_aquariumlevels.size();
-            auto npcCreature = std::static_pointer_cast<NPCreature>(creature);
-            this->m_aquariumlevels.at(selectLvl)->ConsumePopulation(npcCreature->GetType(), npcCreature->getValue());
+        if (m_level != nullptr && m_store.columns.value[row] != -999) {
+            m_level->ConsumePopulation(m_store.type[row], m_store.columns.value[row]);
         }
         
-        m_creatures.erase(it);
+        int last = m_store.size() - 1;
+        this->eraseCreatureAt(row);
+
+        // the last row was swapped into the hole: drop the removed fish's
+        // contacts and follow the moved one, like flushRemovals does
+        auto end = std::remove_if(m_contacts.begin(), m_contacts.end(), [row, last](CreatureContact& contact) {
+            if (contact.a == row || contact.b == row) return true;
+            if (contact.a == last) contact.a = row;
+            if (contact.b == last) contact.b = row;
+            if (contact.a > contact.b) std::swap(contact.a, contact.b);
+            return false;
+        });
+        m_contacts.erase(end, m_contacts.end());
+    }
+}
+
+void Aquarium::flushRemovals() {
+    if (m_pendingRemovals.empty()) return;
+    // scratch follows the store's capacity, so it only grows when the store does
+    m_removalRows.clear();
+    m_removalRows.reserve(m_store.capacity());
+    for (CreatureHandle handle : m_pendingRemovals) {
+        int row = m_store.rowOf(handle);
+        if (row != -1) m_removalRows.push_back(row);
+    }
+    m_pendingRemovals.clear();
+
+    // highest row first: the row swapped down into the hole then always
+    // comes from past every row still waiting to go
+    std::sort(m_removalRows.begin(), m_removalRows.end(), std::greater<int>());
+    m_removalRows.erase(std::unique(m_removalRows.begin(), m_removalRows.end()), m_removalRows.end());
+
+    // follow where every row ends up so the contact buffer can be rewritten
+    // to describe the tank as it is now
+    int count = m_store.size();
+    m_remap.reserve(m_store.capacity());
+    m_rowOrigin.reserve(m_store.capacity());
+    m_remap.resize(count);
+    m_rowOrigin.resize(count);
+    for (int i = 0; i < count; ++i) {
+        m_remap[i] = i;
+        m_rowOrigin[i] = i;
     }
+    for (int row : m_removalRows) {
+        int last = m_store.size() - 1;
+        m_remap[m_rowOrigin[row]] = -1;
+        if (row != last) {
+            m_rowOrigin[row] = m_rowOrigin[last];
+            m_remap[m_rowOrigin[row]] = row;
+        }
+        this->eraseCreatureAt(row);
+    }
+
+    auto end = std::remove_if(m_contacts.begin(), m_contacts.end(), [&](CreatureContact& contact) {
+        contact.a = m_remap[contact.a];
+        contact.b = m_remap[contact.b];
+        if (contact.a > contact.b) std::swap(contact.a, contact.b);
+        return contact.a == -1;
+    });
+    m_contacts.erase(end, m_contacts.end());
+}
+
+void Aquarium::eraseCreatureAt(int index) {
+    m_pool.release(m_store.type[index], m_store.owner[index]);
+    m_store.erase(index);
+    m_gridDirty = true;
 }
 
 void Aquarium::clearCreatures() {
-    m_creatures.clear();
+    for (int i = 0; i < m_store.size(); ++i) {
+        m_pool.release(m_store.type[i], m_store.owner[i]);
+    }
+    m_store.clear();
+    m_spawnQueue.clear();
+    m_spawnHead = 0;
+    m_gridDirty = true;
+}
+
+// Recycled creature of this type reset in place, or a new one.
+template <typename T>
+std::shared_ptr<NPCreature> Aquarium::makeCreature(AquariumCreatureType type, float x, float y, int speed) {
+    if (std::shared_ptr<NPCreature> creature = m_pool.acquire(type)) {
+        creature->reset(x, y, speed);
+        return creature;
+    }
+    m_pool.track(type);
+    return std::make_shared<T>(x, y, speed, this->m_sprite_manager->GetSprite(type), m_rng);
+}
+
+void Aquarium::refreshSpatialGrid() {
+    if (!m_gridDirty) return;
+    AQ_PROFILE_SCOPE("SpatialGrid rebuild");
+    m_grid.rebuild(m_store.columns, m_width, m_height, m_jobs);
+    m_gridDirty = false;
+}
+
+// All overlapping pairs in the tank. The grid is the broadphase, the
+// checkCollision test (circlesOverlap) the narrowphase; each pair is reported
+// once as (lower index, higher index).
+void Aquarium::detectCreatureContacts() {
+    AQ_PROFILE_SCOPE("Creature contacts");
+    m_contacts.clear();
+    this->refreshSpatialGrid();
+    const CreatureColumns& c = m_store.columns;
+    for (int i = 0; i < c.size(); ++i) {
+        m_grid.query(c.x[i], c.y[i], c.collisionRadius[i], [&](int j) {
+            if (j > i && circlesOverlap(c.x[i], c.y[i], c.collisionRadius[i], c.x[j], c.y[j], c.collisionRadius[j])) {
+                m_contacts.push_back({i, j});
+            }
+        });
+    }
+}
+
+// A predator eats the other fish of a contact when that fish is worth less
+// than itself. Power-ups and other predators are never eaten. The eaten fish
+// goes back to the level pool (without scoring) so the level respawns it.
+void Aquarium::resolvePredation() {
+    if (m_contacts.empty()) return;
+    m_eaten.assign(m_store.size(), 0);
+    const std::vector<AquariumCreatureType>& type = m_store.type;
+    const std::vector<int>& value = m_store.columns.value;
+
+    bool anyEaten = false;
+    for (const CreatureContact& contact : m_contacts) {
+        int a = contact.a;
+        int b = contact.b;
+        if (m_eaten[a] || m_eaten[b]) continue;
+
+        int prey = -1;
+        if (isPredatorType(type[a]) && !isPredatorType(type[b]) && value[b] != -999 && value[b] < value[a]) {
+            prey = b;
+        } else if (isPredatorType(type[b]) && !isPredatorType(type[a]) && value[a] != -999 && value[a] < value[b]) {
+            prey = a;
+        }
+        if (prey != -1) {
+            m_eaten[prey] = 1;
+            anyEaten = true;
+        }
+    }
+    if (!anyEaten) return;
+
+    // the eaten fish leave at the end of the tick (flushRemovals)
+    m_pendingRemovals.reserve(m_store.capacity());
+    for (int i = 0; i < m_store.size(); ++i) {
+        if (!m_eaten[i]) continue;
+        if (m_level != nullptr) {
+            m_level->ConsumePopulation(type[i], 0);
+        }
+        this->queueRemoval(m_store.owner[i]->getHandle());
+    }
 }
 
 std::shared_ptr<Creature> Aquarium::getCreatureAt(int index) {
-    if (index < 0 || size_t(index) >= m_creatures.size()) {
+    if (index < 0 || index >= m_store.size()) {
         return nullptr;
     }
-    return m_creatures[index];
+    return m_store.owner[index];
+}
+
+std::shared_ptr<NPCreature> Aquarium::getCreature(CreatureHandle handle) {
+    int row = m_store.rowOf(handle);
+    return row == -1 ? nullptr : m_store.owner[row];
 }
 
 
 
 void Aquarium::SpawnCreature(AquariumCreatureType type) {
-    int x = rand() % this->getWidth();
-    int y = rand() % this->getHeight();
-    int speed = 1 + rand() % 3; // Speed between 1 and 3 (slower)
+    int x = m_rng.nextInt(this->getWidth());
+    int y = m_rng.nextInt(this->getHeight());
+    int speed = 1 + m_rng.nextInt(3); // Speed between 1 and 3 (slower)
 
     switch (type) {
         case AquariumCreatureType::NPCreature:
-            this->addCreature(std::make_shared<NPCreature>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::NPCreature)));
+            this->addCreature(this->makeCreature<NPCreature>(AquariumCreatureType::NPCreature, x, y, speed));
             break;
         case AquariumCreatureType::BiggerFish:
-            this->addCreature(std::make_shared<BiggerFish>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::BiggerFish)));
+            this->addCreature(this->makeCreature<BiggerFish>(AquariumCreatureType::BiggerFish, x, y, speed));
             break;
         case AquariumCreatureType::ZigZagFish:
-            this->addCreature(std::make_shared<ZigZagFish>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::ZigZagFish)));
+            this->addCreature(this->makeCreature<ZigZagFish>(AquariumCreatureType::ZigZagFish, x, y, speed));
             break;
         case AquariumCreatureType::LurkerFish:
-            this->addCreature(std::make_shared<LurkerFish>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::LurkerFish)));
+            this->addCreature(this->makeCreature<LurkerFish>(AquariumCreatureType::LurkerFish, x, y, speed));
             break;
         case AquariumCreatureType::BlueFish:
             {
-                auto fish = std::make_shared<NPCreature>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::BlueFish));
+                auto fish = this->makeCreature<NPCreature>(AquariumCreatureType::BlueFish, x, y, speed);
                 fish->setValue(3); // Blue fish have value 3
+                fish->SetType(AquariumCreatureType::BlueFish);
                 this->addCreature(fish);
             }
             break;
         case AquariumCreatureType::RedFish:
             {
-                auto fish = std::make_shared<NPCreature>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::RedFish));
+                auto fish = this->makeCreature<NPCreature>(AquariumCreatureType::RedFish, x, y, speed);
                 fish->setValue(4); // Red fish have value 4
+                fish->SetType(AquariumCreatureType::RedFish);
                 this->addCreature(fish);
             }
             break;
         case AquariumCreatureType::VioletFish:
             {
-                auto fish = std::make_shared<NPCreature>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::VioletFish));
+                auto fish = this->makeCreature<NPCreature>(AquariumCreatureType::VioletFish, x, y, speed);
                 fish->setValue(5); // Violet fish have value 5
+                fish->SetType(AquariumCreatureType::VioletFish);
                 this->addCreature(fish);
             }
             break;
         case AquariumCreatureType::Shark:
             {
-                auto shark = std::make_shared<BiggerFish>(x, y, speed, this->m_sprite_manager->GetSprite(AquariumCreatureType::Shark));
+                auto shark = this->makeCreature<BiggerFish>(AquariumCreatureType::Shark, x, y, speed);
                 shark->setValue(8); // Sharks have highest value (8)
+                shark->SetType(AquariumCreatureType::Shark);
                 this->addCreature(shark);
             }
             break;
         case AquariumCreatureType::PowerUp: {
             
-            auto sprite = this->m_sprite_manager->GetSprite(AquariumCreatureType::PowerUp);
-            float x = ofRandom(0, m_width);
-            float y = ofRandom(0, m_height);
+            float x = m_rng.range(0, m_width);
+            float y = m_rng.range(0, m_height);
             int speed = 3; 
             
             
-            auto powerUp = std::make_shared<NPCreature>(x, y, speed, sprite);
+            auto powerUp = this->makeCreature<NPCreature>(AquariumCreatureType::PowerUp, x, y, speed);
             powerUp->setValue(-999);
             powerUp->setCollisionRadius(30.0f);
+            powerUp->SetType(AquariumCreatureType::PowerUp);
             this->addCreature(powerUp);
             break;
         }
         default:
-            ofLogError() << "Unknown creature type to spawn!";
+            AQ_LOG_ERROR("Unknown creature type to spawn!");
             break;
     }
 
@@ -367,28 +732,26 @@ void Aquarium::SpawnCreature(AquariumCreatureType type) {
 // once lvl criteria met, we move to new lvl through inner signal asking for new lvl
 // which will mean incrementing the buffer and pointing to a new lvl index
 void Aquarium::Repopulate() {
-    ofLogVerbose("entering phase repopulation");
-    // Loop back to level 1 after completing all levels
-    int selectedLevelIdx = this->currentLevel % this->m_aquariumlevels.size();
-    ofLogNotice() << "Current level index: " << selectedLevelIdx << " (Level " << (selectedLevelIdx + 1) << ")" << endl;
-    std::shared_ptr<AquariumLevel> level = this->m_aquariumlevels.at(selectedLevelIdx);
-
+    // nothing was eaten or reset since the last call: no spawns, no level change
+    if (m_level == nullptr || !m_level->hasDirtyTypes()) return;
+    AQ_LOG_VERBOSE("entering phase repopulation");
+    AQ_LOG_VERBOSE("Current level index: " << m_level->getLevelNumber() << " (Level " << (m_level->getLevelNumber() + 1) << ")");
 
-    if(level->isCompleted()){
-        level->levelReset();
+    if(m_level->isCompleted()){
+        m_level->levelReset();
         this->currentLevel += 1;
         
         // Check if all levels completed (6 levels: 0-5, so currentLevel == 6 means victory)
-        if (this->currentLevel >= this->m_aquariumlevels.size()) {
-            ofLogNotice() << "🎉 VICTORY! All levels completed!";
+        if (this->currentLevel >= (int)this->m_aquariumlevels.size()) {
+            AQ_LOG_NOTICE("🎉 VICTORY! All levels completed!");
             m_justLeveledUp = true; // Trigger victory display
+            this->selectLevel();
             return; // Don't repopulate, game is won
         }
         
         // Loop back to the beginning
-        selectedLevelIdx = this->currentLevel % this->m_aquariumlevels.size();
-        ofLogNotice() << " LEVEL UP! New level reached: " << selectedLevelIdx << " (Level " << (selectedLevelIdx + 1) << ")" << std::endl;
-        level = this->m_aquariumlevels.at(selectedLevelIdx);
+        this->selectLevel();
+        AQ_LOG_NOTICE(" LEVEL UP! New level reached: " << m_level->getLevelNumber() << " (Level " << (m_level->getLevelNumber() + 1) << ")");
         this->clearCreatures();
 
         // Level-Up signal
@@ -396,62 +759,92 @@ void Aquarium::Repopulate() {
     }
 
     
-    // now lets find how many to respawn if needed 
-    std::vector<AquariumCreatureType> toRespawn = level->Repopulate();
-    ofLogVerbose() << "amount to repopulate : " << toRespawn.size() << endl;
-    if(toRespawn.size() <= 0 ){return;} // there is nothing for me to do here
-    for(AquariumCreatureType newCreatureType : toRespawn){
-        this->SpawnCreature(newCreatureType);
+    // queue what is missing; spawnQueued() brings it in over the next ticks
+    m_spawnQueue.erase(m_spawnQueue.begin(), m_spawnQueue.begin() + m_spawnHead);
+    m_spawnHead = 0;
+    m_level->Repopulate(m_spawnQueue);
+    AQ_LOG_VERBOSE("amount to repopulate : " << m_spawnQueue.size());
+}
+
+void Aquarium::spawnQueued() {
+    AQ_PROFILE_SCOPE("Spawning");
+    int end = (int)m_spawnQueue.size();
+    if (m_spawnBudget > 0) {
+        end = std::min(end, m_spawnHead + m_spawnBudget);
+    }
+    for (; m_spawnHead < end; ++m_spawnHead) {
+        this->SpawnCreature(m_spawnQueue[m_spawnHead]);
+    }
+    if (m_spawnHead == (int)m_spawnQueue.size()) {
+        m_spawnQueue.clear();
+        m_spawnHead = 0;
     }
 }
 
 
 // Aquarium collision detection
-std::shared_ptr<GameEvent> DetectAquariumCollisions(std::shared_ptr<Aquarium> aquarium, std::shared_ptr<PlayerCreature> player) {
-    if (!aquarium || !player) return nullptr;
-    
-    for (int i = 0; i < aquarium->getCreatureCount(); ++i) {
-        auto npc = aquarium->getCreatureAt(i);
-        if (npc && checkCollision(player, npc)) {
-            return std::make_shared<GameEvent>(GameEventType::COLLISION, player, npc);
-        }
+GameEvent DetectAquariumCollisions(std::shared_ptr<Aquarium> aquarium, std::shared_ptr<PlayerCreature> player) {
+    if (!aquarium || !player) return GameEvent();
+
+    // only the player's neighbouring cells are tested; keep the lowest index
+    // so the reported hit matches a front-to-back scan of the tank
+    int hit = -1;
+    aquarium->forEachCreatureNear(player->getX(), player->getY(), player->getCollisionRadius(),
+        [&](int index, const Creature& npc) {
+            if ((hit == -1 || index < hit) && checkCollision(*player, npc)) {
+                hit = index;
+            }
+        });
+
+    if (hit != -1) {
+        return GameEvent(GameEventType::COLLISION, player->getHandle(), aquarium->getCreatureAt(hit)->getHandle());
     }
-    return nullptr;
+    return GameEvent();
 };
 
 //  Imlementation of the AquariumScene
 
 void AquariumGameScene::Update(){
      if (!m_aquarium || !m_player) return;
+    AQ_PROFILE_SCOPE("Scene::Update");
 
     // 1) mover player
-    m_player->update();
+    {
+        AQ_PROFILE_SCOPE("Player::update");
+        m_player->update();
+    }
 
     // 2) mover NPCs / repoblar / niveles
     m_aquarium->update();
     
-    // Decrement invincibility timer
+    // Decrement the tick timers; Draw only reads them
     if (m_invincibilityTimer > 0) {
         m_invincibilityTimer--;
     }
+    if (m_victoryTimer > 0) {
+        m_victoryTimer--;
+    }
+    if (m_levelUpTimer > 0) {
+        m_levelUpTimer--;
+    }
     
     if (m_aquarium->hasJustLeveledUp()) {
         m_aquarium->clearLevelUpFlag();
         
         // Check if player has completed all levels (victory condition)
         if (m_aquarium->getCurrentLevel() >= m_aquarium->getLevelCount()) {
-            m_victoryTimer = 300; // Show victory message for 5 seconds
+            m_victoryTimer = SecondsToTicks(5.0f); // Show victory message for 5 seconds
             m_hasWon = true;
-            ofLogNotice() << "🏆 VICTORY! You Won!";
+            AQ_LOG_NOTICE("🏆 VICTORY! You Won!");
             return; // Stop normal gameplay
         }
         
         // Reset invincibility timer for new level (5 seconds)
-        m_invincibilityTimer = 300;
-        ofLogNotice() << "🛡️ NEW LEVEL - 5 seconds of invincibility!";
+        this->resetInvincibility();
+        AQ_LOG_NOTICE("🛡️ NEW LEVEL - 5 seconds of invincibility!");
         
-        m_levelUpTimer = 180; // spawn message for 3s
-        m_lastEvent = std::make_shared<GameEvent>(GameEventType::NEW_LEVEL, m_player, nullptr);
+        m_levelUpTimer = SecondsToTicks(3.0f); // spawn message for 3s
+        m_events.publish(GameEvent(GameEventType::NEW_LEVEL, m_player->getHandle(), CreatureHandle(), m_aquarium->getCurrentLevel()));
 
         // Increase player power on level-up
         m_player->increasePower(1);
@@ -468,33 +861,31 @@ void AquariumGameScene::Update(){
             default: m_player->setTintColor(ofColor::purple); break;
         }
         
-        ofLogNotice() << " Player leveled up! Power: " << power << " Size: " << (1.0f + power * 0.05f) << "x";
-
-        // Plays level-Up sound
-        if (m_levelUpSound != nullptr) {
-            ofLogNotice() << " LEVEL UP! Playing level-up sound...";
-            m_levelUpSound->play();
-        }
+        AQ_LOG_NOTICE(" Player leveled up! Power: " << power << " Size: " << (1.0f + power * 0.05f) << "x");
     }
 
     // 3) detectar colisiones
-    auto event = DetectAquariumCollisions(m_aquarium, m_player);
-    if (event && event->isCollisionEvent() && event->creatureA && event->creatureB) {
-        ofLogNotice() << "⚡ COLLISION DETECTED! Hit sound ptr: " << (void*)m_hitSound;
-        auto A = event->creatureA; // player
-        auto B = event->creatureB; // npc
+    GameEvent event;
+    {
+        AQ_PROFILE_SCOPE("Player collisions");
+        event = DetectAquariumCollisions(m_aquarium, m_player);
+    }
+    std::shared_ptr<NPCreature> B = event.isCollisionEvent() ? m_aquarium->getCreature(event.handleB) : nullptr;
+    if (B) {
+        AQ_LOG_VERBOSE("⚡ COLLISION DETECTED!");
+        auto A = m_player;
 
         
         if (B->getValue() == -999) {
-            ofLogNotice() << " Player picked up Speed Power-Up!";
+            AQ_LOG_NOTICE(" Player picked up Speed Power-Up!");
             
            
             m_player->setSpeedMultiplier(1.5f);
             m_aquarium->setSpeedMultiplier(1.5f);
-            m_aquarium->setPowerUpActiveTimer(600); 
+            m_aquarium->setPowerUpActiveTimer(SecondsToTicks(10.0f));
             
             m_aquarium->removeCreature(B);
-            m_lastEvent = std::make_shared<GameEvent>(GameEventType::POWER_UP_COLLECTED, m_player, B);
+            m_events.publish(GameEvent(GameEventType::POWER_UP_COLLECTED, A->getHandle(), event.handleB));
             return;
         }
 
@@ -507,13 +898,13 @@ void AquariumGameScene::Update(){
         const float pushWeak = 20.0f;  // Strong bounce when hitting enemy fish
         const float pushEat  = 4.0f;  // empujón suave al comer
 
-        ofLogNotice() << "🐟 COLLISION! Player power: " << m_player->getPower() << " vs Fish value: " << B->getValue() << " (Type: " << AquariumCreatureTypeToString(std::static_pointer_cast<NPCreature>(B)->GetType()) << ")";
+        AQ_LOG_VERBOSE("🐟 COLLISION! Player power: " << m_player->getPower() << " vs Fish value: " << B->getValue() << " (Type: " << AquariumCreatureTypeToString(B->GetType()) << ")");
 
         //  balance: solo come si es estrictamente mayor
         if (m_player->getPower() < B->getValue()) {
             // Check if player is invincible
             if (m_invincibilityTimer > 0) {
-                ofLogNotice() << "🛡️ Player is INVINCIBLE! No damage taken. Time left: " << (m_invincibilityTimer / 60.0f) << "s";
+                AQ_LOG_VERBOSE("🛡️ Player is INVINCIBLE! No damage taken. Time left: " << (m_invincibilityTimer / (float)kSimulationHz) << "s");
                 // Still bounce off the fish, but no damage
                 A->moveBy( nx * pushWeak,  ny * pushWeak);
                 B->moveBy(-nx * pushWeak, -ny * pushWeak);
@@ -522,33 +913,24 @@ void AquariumGameScene::Update(){
                 return; // Skip damage
             }
             
-            ofLogNotice() << " Player WEAKER - Losing life!";
+            AQ_LOG_VERBOSE(" Player WEAKER - Losing life!");
             // Strong bounce to prevent passing through enemy fish
             A->moveBy( nx * pushWeak,  ny * pushWeak);
             B->moveBy(-nx * pushWeak, -ny * pushWeak);
             A->bounce();
             B->bounce();
 
-            m_player->loseLife(10); // Very short debounce - about 0.16 seconds
-            
-            // Play hit sound directly
-            if (m_hitSound != nullptr) {
-                ofLogNotice() << " Playing hit sound directly!";
-                m_hitSound->play();
-            } else {
-                ofLogWarning() << " Hit sound not available!";
-            }
-            
-            // Also emit event for tracking
-            m_lastEvent = std::make_shared<GameEvent>(GameEventType::PLAYER_HIT, m_player, B);
+            m_player->loseLife(SecondsToTicks(0.16f)); // Very short debounce
+            m_events.publish(GameEvent(GameEventType::PLAYER_HIT, A->getHandle(), event.handleB, m_player->getLives()));
             
             if (m_player->getLives() <= 0) {
-                ofLogNotice() << "💀 Game Over - No lives left!";
-                m_lastEvent = std::make_shared<GameEvent>(GameEventType::GAME_OVER, m_player, nullptr);
+                AQ_LOG_NOTICE("💀 Game Over - No lives left!");
+                m_gameOver = true;
+                m_events.publish(GameEvent(GameEventType::GAME_OVER, A->getHandle(), CreatureHandle(), m_player->getScore()));
                 return;
             }
         } else {
-            ofLogNotice() << "Player STRONGER or EQUAL - Eating fish!";
+            AQ_LOG_VERBOSE("Player STRONGER or EQUAL - Eating fish!");
             // come → empujón solo al player, luego remove
             A->moveBy(nx * pushEat, ny * pushEat);
             A->bounce();
@@ -556,16 +938,17 @@ void AquariumGameScene::Update(){
             m_aquarium->removeCreature(B);
             m_player->addToScore(1, B->getValue());
 
-            m_lastEvent = std::make_shared<GameEvent>(GameEventType::CREATURE_REMOVED, m_player, B);
+            m_events.publish(GameEvent(GameEventType::CREATURE_REMOVED, A->getHandle(), event.handleB, B->getValue()));
         }
     }
 }
 
 void AquariumGameScene::Draw() {
+    AQ_PROFILE_SCOPE("Scene::Draw");
     // Draw player with blinking effect if invincible
     if (m_invincibilityTimer > 0) {
-        // Blink every 10 frames (fast blink)
-        if ((m_invincibilityTimer / 10) % 2 == 0) {
+        // Blink every 1/6 s (fast blink)
+        if ((m_invincibilityTimer / SecondsToTicks(1.0f / 6.0f)) % 2 == 0) {
             this->m_player->draw();
         }
     } else {
@@ -579,7 +962,7 @@ void AquariumGameScene::Draw() {
     if (m_invincibilityTimer > 0) {
         ofPushStyle();
         ofSetColor(ofColor::cyan);
-        float timeLeft = m_invincibilityTimer / 60.0f; // Convert frames to seconds
+        float timeLeft = m_invincibilityTimer / (float)kSimulationHz; // Convert ticks to seconds
         string invincText = "INVINCIBLE: " + ofToString(timeLeft, 1) + "s";
         float textWidth = invincText.length() * 8; // Approximate width
         ofDrawBitmapString(invincText, (ofGetWidth() - textWidth) / 2, 30);
@@ -605,7 +988,6 @@ void AquariumGameScene::Draw() {
             
             ofPopStyle();
         }
-        m_victoryTimer--;
         return; // Don't draw level-up if showing victory
     }
     
@@ -629,13 +1011,13 @@ void AquariumGameScene::Draw() {
             
             ofPopStyle();
         }
-        m_levelUpTimer--;
     }
 
 }
 
 
 void AquariumGameScene::paintAquariumHUD(){
+    AQ_PROFILE_SCOPE("HUD");
     float panelWidth = ofGetWindowWidth() - 150;
     int currentLevelIndex = m_aquarium->getCurrentLevel() % m_aquarium->getLevelCount();
     ofDrawBitmapString("Level: " + std::to_string(currentLevelIndex + 1), panelWidth, 10);
@@ -652,19 +1034,21 @@ void AquariumGameScene::paintAquariumHUD(){
 void AquariumLevel::populationReset(){
     for(auto node: this->m_levelPopulation){
         node->currentPopulation = 0; // need to reset the population to ensure they are made a new in the next level
+        this->markDirty(node->creatureType);
     }
 }
 
 void AquariumLevel::ConsumePopulation(AquariumCreatureType creatureType, int power){
     for(std::shared_ptr<AquariumLevelPopulationNode> node: this->m_levelPopulation){
-        ofLogVerbose() << "consuming from this level creatures" << endl;
+        AQ_LOG_VERBOSE("consuming from this level creatures");
         if(node->creatureType == creatureType){
-            ofLogVerbose() << "-cosuming from type: " << AquariumCreatureTypeToString(node->creatureType) <<" , currPop: " << node->currentPopulation << endl;
+            AQ_LOG_VERBOSE("-cosuming from type: " << AquariumCreatureTypeToString(node->creatureType) <<" , currPop: " << node->currentPopulation);
             if(node->currentPopulation == 0){
                 return;
             }
             node->currentPopulation -= 1;
-            ofLogVerbose() << "+cosuming from type: " << AquariumCreatureTypeToString(node->creatureType) <<" , currPop: " << node->currentPopulation << endl;
+            this->markDirty(creatureType);
+            AQ_LOG_VERBOSE("+cosuming from type: " << AquariumCreatureTypeToString(node->creatureType) <<" , currPop: " << node->currentPopulation);
             this->m_level_score += power;
             return;
         }
@@ -675,49 +1059,20 @@ bool AquariumLevel::isCompleted(){
     return this->m_level_score >= this->m_targetScore;
 }
 
-
-
-
-std::vector<AquariumCreatureType> Level_0::Repopulate() {
-    std::vector<AquariumCreatureType> toRepopulate;
-    for(std::shared_ptr<AquariumLevelPopulationNode> node : this->m_levelPopulation){
-        int delta = node->population - node->currentPopulation;
-        ofLogVerbose() << "to Repopulate :  " << delta << endl;
-        if(delta >0){
-            for(int i = 0; i<delta; i++){
-                toRepopulate.push_back(node->creatureType);
-            }
-            node->currentPopulation += delta;
-        }
-    }
-    return toRepopulate;
-
+void AquariumLevel::addPopulation(AquariumCreatureType creatureType, int population){
+    this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(creatureType, population));
+    this->markDirty(creatureType);
 }
 
-std::vector<AquariumCreatureType> Level_1::Repopulate() {
-    std::vector<AquariumCreatureType> toRepopulate;
-    for(std::shared_ptr<AquariumLevelPopulationNode> node : this->m_levelPopulation){
+void AquariumLevel::Repopulate(std::vector<AquariumCreatureType>& toRepopulate){
+    if(m_dirtyTypes == 0){return;}
+    for(const auto& node : this->m_levelPopulation){
+        if(!this->isDirty(node->creatureType)){continue;}
         int delta = node->population - node->currentPopulation;
-        if(delta >0){
-            for(int i=0; i<delta; i++){
-                toRepopulate.push_back(node->creatureType);
-            }
+        if(delta > 0){
+            toRepopulate.insert(toRepopulate.end(), delta, node->creatureType);
             node->currentPopulation += delta;
         }
     }
-    return toRepopulate;
+    m_dirtyTypes = 0;
 }
-
-std::vector<AquariumCreatureType> Level_2::Repopulate() {
-    std::vector<AquariumCreatureType> toRepopulate;
-    for(std::shared_ptr<AquariumLevelPopulationNode> node : this->m_levelPopulation){
-        int delta = node->population - node->currentPopulation;
-        if(delta >0){
-            for(int i=0; i<delta; i++){
-                toRepopulate.push_back(node->creatureType);
-            }
-            node->currentPopulation += delta;
-        }
-    }
-    return toRepopulate;
-} 
@@ -5,6 +5,13 @@
 #include <iostream>
 #include <algorithm>
 #include "Core.h"
+#include "EventQueue.h"
+#include "SpatialGrid.h"
+#include "SpriteBatch.h"
+#include "Random.h"
+
+class AssetLoader;
+class JobSystem;
 
 
 enum class AquariumCreatureType {
@@ -18,8 +25,12 @@ enum class AquariumCreatureType {
     VioletFish,
     Shark
 };
+constexpr int kAquariumCreatureTypeCount = (int)AquariumCreatureType::Shark + 1;
+static_assert(kAquariumCreatureTypeCount <= 32, "AquariumLevel keeps dirty types in a 32-bit mask");
 
 string AquariumCreatureTypeToString(AquariumCreatureType t);
+// Parses the enumerator name ("NPCreature", "Shark", ...); false if unknown.
+bool AquariumCreatureTypeFromString(const std::string& name, AquariumCreatureType& type);
 
 class AquariumLevelPopulationNode{
     public:
@@ -38,15 +49,28 @@ class AquariumLevel : public GameLevel {
     public:
         AquariumLevel(int levelNumber, int targetScore)
         : GameLevel(levelNumber), m_level_score(0), m_targetScore(targetScore){};
+        // The level keeps `population` creatures of this type in the tank.
+        void addPopulation(AquariumCreatureType creatureType, int population);
         void ConsumePopulation(AquariumCreatureType creature, int power);
         bool isCompleted() override;
         void populationReset();
         void levelReset(){m_level_score=0;this->populationReset();}
-        virtual std::vector<AquariumCreatureType> Repopulate() = 0;
+        int getTargetScore() const { return m_targetScore; }
+        // Types that lost a creature (or were reset) since the last
+        // Repopulate(); the score only moves when one is consumed, so nothing
+        // dirty also means isCompleted() has not changed.
+        bool hasDirtyTypes() const { return m_dirtyTypes != 0; }
+        // Appends the creatures to spawn for the dirty types to toRepopulate
+        // (a reused buffer) and clears them.
+        virtual void Repopulate(std::vector<AquariumCreatureType>& toRepopulate);
     protected:
+        void markDirty(AquariumCreatureType type) { m_dirtyTypes |= 1u << (int)type; }
+        bool isDirty(AquariumCreatureType type) const { return (m_dirtyTypes >> (int)type) & 1u; }
+
         std::vector<std::shared_ptr<AquariumLevelPopulationNode>> m_levelPopulation;
         int m_level_score;
         int m_targetScore;
+        uint32_t m_dirtyTypes = 0; // one bit per AquariumCreatureType
 
 };
 
@@ -61,10 +85,10 @@ public:
     void changeSpeed(int speed);
     void setLives(int lives) { m_lives = lives; }
     void setDirection(float dx, float dy);
-    float isXDirectionActive() { return m_dx != 0; }
-    float isYDirectionActive() {return m_dy != 0; }
-    float getDx() { return m_dx; }
-    float getDy() { return m_dy; }
+    float isXDirectionActive() { return dirX() != 0; }
+    float isYDirectionActive() {return dirY() != 0; }
+    float getDx() { return dirX(); }
+    float getDy() { return dirY(); }
 
     int getScore()const { return m_score; }
     int getLives() const { return m_lives; }
@@ -76,138 +100,172 @@ public:
     void reduceDamageDebounce();
     void setSpeedMultiplier(float mult) { m_speedMultiplier = mult; }
     void setTintColor(const ofColor& color) { m_tintColor = color; }
+    // Fraction of a tick past the last update(); draw() lerps from the
+    // previous position by this much.
+    void setRenderAlpha(float alpha) { m_renderAlpha = alpha; }
     
 private:
     int m_score = 0;
     int m_lives = 3;
     int m_power = 1; // mark current power lvl
-    int m_damage_debounce = 0; // frames to wait after eating
+    int m_damage_debounce = 0; // ticks to wait after eating
     float m_speedMultiplier = 1.0f;
     ofColor m_tintColor = ofColor::white;
+    float m_prevX = 0.0f, m_prevY = 0.0f;
+    float m_renderAlpha = 1.0f;
 };
 
 class NPCreature : public Creature {
 public:
-    NPCreature(float x, float y, int speed, std::shared_ptr<GameSprite> sprite);
-    AquariumCreatureType GetType() {return this->m_creatureType;}
+    // rng is the owning tank's generator; it must outlive the creature.
+    NPCreature(float x, float y, int speed, std::shared_ptr<GameSprite> sprite, RandomGenerator& rng);
+    // Re-runs construction in place for a pooled creature: same state and
+    // same draws from the generator as a new one. Keeps the sprite.
+    virtual void reset(float x, float y, int speed);
+    AquariumCreatureType GetType() const {return this->m_creatureType;}
+    void SetType(AquariumCreatureType type) {this->m_creatureType = type;}
     void move() override;
     void draw() const override;
+    float linearSpeedScale() const override { return 1.0f; }
 protected:
     AquariumCreatureType m_creatureType;
+    RandomGenerator* m_rng;
 
 };
 
 class BiggerFish : public NPCreature {
 public:
-    BiggerFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite);
+    BiggerFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite, RandomGenerator& rng);
+    void reset(float x, float y, int speed) override;
     void move() override;
     void draw() const override;
+    float linearSpeedScale() const override { return 0.5f; } // half speed
+private:
+    void initBiggerFish(int speed);
 };
 
 class ZigZagFish : public NPCreature {
 public:
-    ZigZagFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite)
-        : NPCreature(x, y, speed, sprite), counter(0) {
-        m_dx = (rand() % 2 == 0) ? 1 : -1;  // Random horizontal direction
-        m_dy = (rand() % 2 == 0) ? 1 : -1;  // Random vertical direction
-        Creature::setValue(7); 
-        m_creatureType = AquariumCreatureType::ZigZagFish;
+    ZigZagFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite, RandomGenerator& rng)
+        : NPCreature(x, y, speed, sprite, rng) {
+        this->initZigZag();
+    }
+
+    void reset(float x, float y, int speed) override {
+        NPCreature::reset(x, y, speed);
+        this->initZigZag();
     }
 
+    float linearSpeedScale() const override { return 0.0f; }
+
     void move() override {
         counter++;
-        if (counter % 30 == 0) { // Faster zigzag - every 0.5 seconds
-            m_dy = -m_dy; // zigzag pattern
+        if (counter % SecondsToTicks(0.5f) == 0) { // Faster zigzag - every 0.5 seconds
+            dirY() = -dirY(); // zigzag pattern
         }
         Creature::normalize();
-        m_x += m_dx * m_speed;
-        m_y += m_dy * m_speed;
-        if(m_dx < 0) {
-            this->m_sprite->setFlipped(true);
-        } else {
-            this->m_sprite->setFlipped(false);
-        }
+        posX() += dirX() * speed() * kTickSpeedScale;
+        posY() += dirY() * speed() * kTickSpeedScale;
         Creature::bounce();
     }
     
     void draw() const override {
-        ofSetColor(ofColor::white);
         if (m_sprite) {
-            m_sprite->draw(m_x, m_y);
+            m_sprite->draw(posX(), posY(), dirX() < 0);
         }
     }
 
 private:
+    void initZigZag() {
+        counter = 0;
+        dirX() = (m_rng->nextInt(2) == 0) ? 1 : -1;  // Random horizontal direction
+        dirY() = (m_rng->nextInt(2) == 0) ? 1 : -1;  // Random vertical direction
+        Creature::setValue(7); 
+        m_creatureType = AquariumCreatureType::ZigZagFish;
+    }
+
     int counter;
 };
 
 class LurkerFish : public NPCreature {
 public:
-    LurkerFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite)
-        : NPCreature(x, y, speed, sprite), darting(false), dartTimer(0), growthTimer(0), growthCounter(0), currentSize(60) {
-        m_dx = (rand() % 2 == 0) ? 1 : -1;  // Random horizontal direction
-        m_dy = 0;
-        Creature::setValue(6); 
-        m_creatureType = AquariumCreatureType::LurkerFish; 
+    LurkerFish(float x, float y, int speed, std::shared_ptr<GameSprite> sprite, RandomGenerator& rng)
+        : NPCreature(x, y, speed, sprite, rng) {
+        this->initLurker();
+    }
+
+    void reset(float x, float y, int speed) override {
+        NPCreature::reset(x, y, speed);
+        this->initLurker();
     }
 
+    float linearSpeedScale() const override { return 0.0f; }
+
     void move() override {
         dartTimer++;
         growthTimer++;
         
         growthCounter++;
-        if (growthCounter % 300 == 0) { // every 5 seconds at 60fps
-            m_collisionRadius += 2.0f;
+        if (growthCounter % SecondsToTicks(5.0f) == 0) { // every 5 seconds
+            radius() += 2.0f;
             currentSize += 10; // Also increase visual size
-            ofLogNotice() << " LurkerFish growing! Size: " << currentSize << " Radius: " << m_collisionRadius;
+            AQ_LOG_VERBOSE(" LurkerFish growing! Size: " << currentSize << " Radius: " << radius());
         }
         
         // Grow visual size slowly over time
-        if (growthTimer % 120 == 0 && currentSize < 120) {
+        if (growthTimer % SecondsToTicks(2.0f) == 0 && currentSize < 120) {
             currentSize += 5;
         }
         
-        if (!darting && dartTimer > 180 && ofRandom(1.0) < 0.05f) {
+        if (!darting && dartTimer > SecondsToTicks(3.0f) && m_rng->nextFloat() < 0.05f * kTickSpeedScale) {
             darting = true;
             dartTimer = 0;
-            m_dy = -3;
+            dirY() = -3;
         }
         if (darting) {
-            m_x += m_dx * m_speed;
-            m_y += m_dy;
-            m_dy += 0.2f;
-            if (m_dy > 2) {
-                m_dy = 0;
+            posX() += dirX() * speed() * kTickSpeedScale;
+            posY() += dirY() * kTickSpeedScale;
+            dirY() += 0.2f * kTickSpeedScale;
+            if (dirY() > 2) {
+                dirY() = 0;
                 darting = false;
             }
         } else {
-            m_x += m_dx * m_speed;
-        }
-        if(m_dx < 0) {
-            this->m_sprite->setFlipped(true);
-        } else {
-            this->m_sprite->setFlipped(false);
+            posX() += dirX() * speed() * kTickSpeedScale;
         }
         Creature::bounce();
     }
     
+    float getDrawScale() const override { return currentSize / 60.0f; }
+
     void draw() const override {
-        ofLogNotice() << "🐟 Drawing LurkerFish at (" << m_x << ", " << m_y << ") size: " << currentSize;
-        ofSetColor(ofColor::white);
+        AQ_LOG_VERBOSE("🐟 Drawing LurkerFish at (" << posX() << ", " << posY() << ") size: " << currentSize);
         if (m_sprite) {
             // Draw with dynamic size
             ofPushMatrix();
-            ofTranslate(m_x, m_y);
-            float scale = currentSize / 60.0f;
+            ofTranslate(posX(), posY());
+            float scale = getDrawScale();
             ofScale(scale, scale);
-            m_sprite->draw(0, 0);
+            m_sprite->draw(0, 0, dirX() < 0);
             ofPopMatrix();
         } else {
-            ofLogError() << "LurkerFish sprite is NULL!";
+            AQ_LOG_ERROR("LurkerFish sprite is NULL!");
         }
     }
 
 private:
+    void initLurker() {
+        darting = false;
+        dartTimer = 0;
+        growthTimer = 0;
+        growthCounter = 0;
+        currentSize = 60;
+        dirX() = (m_rng->nextInt(2) == 0) ? 1 : -1;  // Random horizontal direction
+        dirY() = 0;
+        Creature::setValue(6); 
+        m_creatureType = AquariumCreatureType::LurkerFish; 
+    }
+
     bool darting;
     int dartTimer;
     int growthTimer;
@@ -219,212 +277,240 @@ private:
 class AquariumSpriteManager {
     public:
         AquariumSpriteManager();
+#ifndef AQUARIUM_HEADLESS
+        // Same atlas, filled in by the loader's images as they are decoded.
+        explicit AquariumSpriteManager(AssetLoader& loader);
+#endif
         ~AquariumSpriteManager() = default;
-        std::shared_ptr<GameSprite>GetSprite(AquariumCreatureType t);
+        // New sprite instance referencing the shared atlas; no pixel copies.
+        // The atlas is immutable, so tanks on different threads can share one
+        // manager.
+        std::shared_ptr<GameSprite>GetSprite(AquariumCreatureType t) const;
+        std::shared_ptr<const SpriteAtlas> GetAtlas() const { return m_atlas; }
     private:
-        std::shared_ptr<GameSprite> m_npc_fish;
-        std::shared_ptr<GameSprite> m_big_fish;
-        std::shared_ptr<GameSprite> m_power_up;
-        std::shared_ptr<GameSprite> m_zigzag_fish;
-        std::shared_ptr<GameSprite> m_lurker_fish;
-        std::shared_ptr<GameSprite> m_blue_fish;
-        std::shared_ptr<GameSprite> m_red_fish;
-        std::shared_ptr<GameSprite> m_violet_fish;
-        std::shared_ptr<GameSprite> m_shark;
+        std::shared_ptr<const SpriteAtlas> m_atlas;
+};
+
+
+// Two creatures of the same tank whose collision circles overlap, by index
+// into the tank at the time the contact pass ran.
+struct CreatureContact {
+    int a;
+    int b;
+};
+
+bool isPredatorType(AquariumCreatureType t);
+
+
+// Aquarium-side creature storage: the shared state columns plus the columns
+// only the tank needs. Row i of every column belongs to owner[i], and each
+// owner is bound to its row, so the Creature objects act as thin handles.
+// Rows are dense and removal is swap-and-pop, so row order is not stable;
+// CreatureHandles go through a slot table that follows the moves.
+class CreatureStore {
+public:
+    CreatureStore() = default;
+    CreatureStore(const CreatureStore&) = delete; // owners point into columns
+    CreatureStore& operator=(const CreatureStore&) = delete;
+    ~CreatureStore() { this->clear(); }
+
+    CreatureHandle add(std::shared_ptr<NPCreature> creature, AquariumCreatureType creatureType);
+    // Removes a row by moving the last row into it.
+    void erase(int row);
+    void clear();
+    int size() const { return (int)owner.size(); }
+    int capacity() const { return (int)owner.capacity(); }
+
+    // Current row of the creature, or -1 if the handle is stale.
+    int rowOf(CreatureHandle handle) const {
+        if (handle.index < 0 || handle.index >= (int)m_slotGeneration.size()) return -1;
+        if (m_slotGeneration[handle.index] != handle.generation) return -1;
+        return m_slotRow[handle.index];
+    }
+
+    CreatureColumns columns;
+    std::vector<AquariumCreatureType> type;
+    std::vector<float> moveScale; // Creature::linearSpeedScale() per tick, 0 = custom move()
+    std::vector<float> prevX, prevY; // positions before the last tick, for drawing
+    std::vector<std::shared_ptr<NPCreature>> owner;
+
+private:
+    void releaseSlot(int slot);
+
+    std::vector<int> m_rowSlot;             // row -> handle slot
+    std::vector<int> m_slotRow;             // handle slot -> row, -1 when free
+    std::vector<uint32_t> m_slotGeneration; // bumped when the slot is freed
+    std::vector<int> m_freeSlots;
+};
+
+
+// Creatures that left the tank, kept per type (each type has its own sprite)
+// so spawning can reset one in place instead of allocating.
+class CreaturePool {
+public:
+    // Called for every creature built new; grows the free list up front so
+    // releasing never allocates.
+    void track(AquariumCreatureType type);
+    void release(AquariumCreatureType type, std::shared_ptr<NPCreature> creature);
+    // A free creature of this type nothing else still references, or null.
+    std::shared_ptr<NPCreature> acquire(AquariumCreatureType type);
+    int size() const;
+
+private:
+    std::vector<std::shared_ptr<NPCreature>> m_free[kAquariumCreatureTypeCount];
+    int m_created[kAquariumCreatureTypeCount] = {};
 };
 
 
 class Aquarium{
 public:
-    Aquarium(int width, int height, std::shared_ptr<AquariumSpriteManager> spriteManager);
-    void addCreature(std::shared_ptr<Creature> creature);
+    Aquarium(int width, int height, std::shared_ptr<AquariumSpriteManager> spriteManager, uint64_t seed);
+    CreatureHandle addCreature(std::shared_ptr<NPCreature> creature);
     void addAquariumLevel(std::shared_ptr<AquariumLevel> level);
+    // Swaps in a new campaign while running: keeps the current level index
+    // (clamped) and empties the tank so the next Repopulate() spawns the new
+    // population.
+    void setLevels(std::vector<std::shared_ptr<AquariumLevel>> levels);
+    // Immediate O(1) removal (swap-and-pop); the last creature takes the
+    // removed one's index.
     void removeCreature(std::shared_ptr<Creature> creature);
+    void removeCreature(CreatureHandle handle);
+    // Deferred removal: applied by flushRemovals(), which update() calls at
+    // the end of the tick, so indices stay valid for the rest of the tick.
+    // Stale and repeated handles are ignored.
+    void queueRemoval(CreatureHandle handle) { m_pendingRemovals.push_back(handle); }
+    void flushRemovals();
     void clearCreatures();
     void update();
     void draw() const;
     void setBounds(int w, int h) { m_width = w; m_height = h; }
     void setMaxPopulation(int n) { m_maxPopulation = n; }
+    // Creatures spawned per tick from the spawn queue, so a level change
+    // fills the tank over a few ticks instead of in one; 0 spawns all at once.
+    void setSpawnBudget(int perTick) { m_spawnBudget = perTick; }
+    // Spreads the linear movement pass and the grid rebuild of large tanks
+    // over the job system's threads; nullptr (the default) keeps them on the
+    // calling thread. Results are identical either way.
+    void setJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+    int getQueuedSpawnCount() const { return (int)m_spawnQueue.size() - m_spawnHead; }
     void Repopulate();
+    void spawnQueued();
+    void selectLevel();
     void SpawnCreature(AquariumCreatureType type);
     
     std::shared_ptr<Creature> getCreatureAt(int index);
-    int getCreatureCount() const { return m_creatures.size(); }
+    // Null when the handle is stale (the creature was removed since).
+    std::shared_ptr<NPCreature> getCreature(CreatureHandle handle);
+    bool isAlive(CreatureHandle handle) const { return m_store.rowOf(handle) != -1; }
+    int getCreatureCount() const { return m_store.size(); }
+    int getPooledCount() const { return m_pool.size(); }
+    // Contacts from the last update, by current row; removals keep them in step.
+    const std::vector<CreatureContact>& getContacts() const { return m_contacts; }
     int getWidth() const { return m_width; }
     int getHeight() const { return m_height; }
     int getCurrentLevel() const { return currentLevel; }
     int getLevelCount() const { return m_aquariumlevels.size(); }
+    RandomGenerator& getRandom() { return m_rng; }
     
     float getSpeedMultiplier() const { return m_speedMultiplier; }
     void setSpeedMultiplier(float mult) { m_speedMultiplier = mult; }
     void setPowerUpActiveTimer(int frames) { m_powerUpActiveTimer = frames; }
     
+    // Batched drawing builds one vertex buffer for every atlas sprite in the
+    // tank; turning it off draws each creature through its own draw().
+    void setBatchedDraw(bool enabled) { m_batchedDraw = enabled; }
+    // Batched drawing lerps each fish between its last two ticks by alpha.
+    void setRenderAlpha(float alpha) { m_renderAlpha = alpha; }
+
     bool hasJustLeveledUp() const { return m_justLeveledUp; }
     void clearLevelUpFlag() { m_justLeveledUp = false; }
 
+    // Calls visit(index, creature) for the creatures near (x, y) according to
+    // the spatial grid; candidates still need a narrowphase check.
+    template <typename Visitor>
+    void forEachCreatureNear(float x, float y, float radius, Visitor&& visit) {
+        this->refreshSpatialGrid();
+        m_grid.query(x, y, radius, [&](int index) { visit(index, *m_store.owner[index]); });
+    }
+
 
 private:
+    void refreshSpatialGrid();
+    void detectCreatureContacts();
+    void resolvePredation();
+    void eraseCreatureAt(int index);
+    template <typename T>
+    std::shared_ptr<NPCreature> makeCreature(AquariumCreatureType type, float x, float y, int speed);
+
     int m_maxPopulation = 0;
     int m_width;
     int m_height;
     int currentLevel = 0;
+    AquariumLevel* m_level = nullptr; // m_aquariumlevels[currentLevel % count]
     int m_powerUpTimer = 0;
     int m_powerUpActiveTimer = 0;
     float m_speedMultiplier = 1.0f;
     bool m_justLeveledUp = false;
-    std::vector<std::shared_ptr<Creature>> m_creatures;
-    std::vector<std::shared_ptr<Creature>> m_next_creatures;
+    CreatureStore m_store;
+    CreaturePool m_pool;
+    std::vector<CreatureHandle> m_pendingRemovals;
     std::vector<std::shared_ptr<AquariumLevel>> m_aquariumlevels;
     std::shared_ptr<AquariumSpriteManager> m_sprite_manager;
+    RandomGenerator m_rng; // all spawning and creature behaviour draws from this
+    SpatialGrid m_grid;
+    JobSystem* m_jobs = nullptr; // not owned
+    bool m_gridDirty = true; // creatures were added/removed since the last rebuild
+    std::vector<CreatureContact> m_contacts; // reused every frame
+    std::vector<char> m_eaten;               // scratch for resolvePredation
+    std::vector<int> m_remap;                // scratch for flushRemovals
+    std::vector<int> m_rowOrigin;            // scratch for flushRemovals
+    std::vector<int> m_removalRows;          // scratch for flushRemovals
+    std::vector<AquariumCreatureType> m_spawnQueue; // filled by Repopulate, drained by spawnQueued
+    int m_spawnHead = 0;
+    int m_spawnBudget = 4;
+    bool m_batchedDraw = true;
+    float m_renderAlpha = 1.0f;
+    mutable SpriteBatch m_batch;
 };
 
 
-std::shared_ptr<GameEvent> DetectAquariumCollisions(std::shared_ptr<Aquarium> aquarium, std::shared_ptr<PlayerCreature> player);
+// COLLISION event with the hit creature in handleB, or a NONE event.
+GameEvent DetectAquariumCollisions(std::shared_ptr<Aquarium> aquarium, std::shared_ptr<PlayerCreature> player);
 
 
 class AquariumGameScene : public GameScene {
     public:
         AquariumGameScene(std::shared_ptr<PlayerCreature> player, std::shared_ptr<Aquarium> aquarium, string name)
         : m_player(std::move(player)) , m_aquarium(std::move(aquarium)), m_name(name){}
-        std::shared_ptr<GameEvent> GetLastEvent(){return m_lastEvent;}
-        void SetLastEvent(std::shared_ptr<GameEvent> event){this->m_lastEvent = event;}
-        std::shared_ptr<PlayerCreature> GetPlayer(){return this->m_player;}
-        std::shared_ptr<Aquarium> GetAquarium(){return this->m_aquarium;}
+        // Everything that happened in the ticks since the last dispatch().
+        EventQueue& GetEvents() {return m_events;}
+        bool IsGameOver() const {return m_gameOver;}
+        const std::shared_ptr<PlayerCreature>& GetPlayer() const {return this->m_player;}
+        const std::shared_ptr<Aquarium>& GetAquarium() const {return this->m_aquarium;}
         string GetName()override {return this->m_name;}
         void Update() override;
         void Draw() override;
-        void SetHitSound(ofSoundPlayer* sound) { m_hitSound = sound; }
-        void SetLevelUpSound(ofSoundPlayer* sound) { m_levelUpSound = sound; }
-        void PreloadLevelUpImage() { 
-            if (!m_levelUpImage.isAllocated()) {
-                m_levelUpImage.load("LevelUp!.png"); 
-            }
-        }
-        void PreloadVictoryImage() { 
-            if (!m_victoryImage.isAllocated()) {
-                m_victoryImage.load("You Won.png"); 
-            }
+        void SetRenderAlpha(float alpha) {
+            m_player->setRenderAlpha(alpha);
+            m_aquarium->setRenderAlpha(alpha);
         }
+        // Banners decoded up front (see AssetLoader) so showing them never stutters.
+        void SetLevelUpImage(const ofPixels& pixels) { m_levelUpImage.setFromPixels(pixels); }
+        void SetVictoryImage(const ofPixels& pixels) { m_victoryImage.setFromPixels(pixels); }
         bool isPlayerInvincible() const { return m_invincibilityTimer > 0; }
-        void resetInvincibility() { m_invincibilityTimer = 300; } // 5 seconds
+        void resetInvincibility() { m_invincibilityTimer = SecondsToTicks(5.0f); }
     private:
         void paintAquariumHUD();
         std::shared_ptr<PlayerCreature> m_player;
         std::shared_ptr<Aquarium> m_aquarium;
-        std::shared_ptr<GameEvent> m_lastEvent;
+        EventQueue m_events;
         string m_name;
         AwaitFrames updateControl{5};
-        ofSoundPlayer* m_hitSound = nullptr;
-        ofSoundPlayer* m_levelUpSound = nullptr;
         int m_levelUpTimer = 0; 
         ofImage m_levelUpImage;
         int m_victoryTimer = 0;
         ofImage m_victoryImage;
-        int m_invincibilityTimer = 0; // No invincibility at start, only on level-ups
+        int m_invincibilityTimer = 0; // ticks; no invincibility at start, only on level-ups
         bool m_hasWon = false;
+        bool m_gameOver = false;
 };
-
-
-class Level_0 : public AquariumLevel  {
-    public:
-        Level_0(int levelNumber, int targetScore): AquariumLevel(levelNumber, targetScore){
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::NPCreature, 15)); // Increased from 10
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::ZigZagFish, 5)); // Increased from 3
-        };
-        std::vector<AquariumCreatureType> Repopulate() override;
-
-};
-class Level_1 : public AquariumLevel  {
-    public:
-        Level_1(int levelNumber, int targetScore): AquariumLevel(levelNumber, targetScore){
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::NPCreature, 20)); // Increased from 15
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::ZigZagFish, 8)); // Increased from 5
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::LurkerFish, 3)); // Increased from 2
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::BlueFish, 5)); // Increased from 3
-        };
-        std::vector<AquariumCreatureType> Repopulate() override;
-
-
-};
-class Level_2 : public AquariumLevel  {
-    public:
-        Level_2(int levelNumber, int targetScore): AquariumLevel(levelNumber, targetScore){
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::NPCreature, 25)); // Increased from 20
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::BiggerFish, 7)); // Increased from 5
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::ZigZagFish, 6)); // Increased from 3
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::LurkerFish, 5)); // Increased from 3
-            this->m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::RedFish, 6)); // Increased from 4
-        };
-        std::vector<AquariumCreatureType> Repopulate() override;
-};
-
-class Level_3 : public AquariumLevel  {
-public:
-    Level_3(int levelNumber, int targetScore)
-    : AquariumLevel(levelNumber, targetScore) {
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::NPCreature, 25)); // Increased from 20
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::ZigZagFish, 8)); // Increased from 5
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::LurkerFish, 6)); // Increased from 4
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::VioletFish, 5)); // Increased from 3
-    }
-
-    std::vector<AquariumCreatureType> Repopulate() override {
-        std::vector<AquariumCreatureType> toRepopulate;
-        for (auto& node : m_levelPopulation) {
-            int delta = node->population - node->currentPopulation;
-            if (delta > 0) {
-                toRepopulate.insert(toRepopulate.end(), delta, node->creatureType);
-                node->currentPopulation += delta;
-            }
-        }
-        return toRepopulate;
-    }
-};
-
-class Level_4 : public AquariumLevel  {
-public:
-    Level_4(int levelNumber, int targetScore)
-    : AquariumLevel(levelNumber, targetScore) {
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::NPCreature, 20)); 
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::ZigZagFish, 10)); 
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::BiggerFish, 8)); 
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::BlueFish, 6)); 
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::Shark, 4)); 
-    }
-
-    std::vector<AquariumCreatureType> Repopulate() override {
-        std::vector<AquariumCreatureType> toRepopulate;
-        for (auto& node : m_levelPopulation) {
-            int delta = node->population - node->currentPopulation;
-            if (delta > 0) {
-                toRepopulate.insert(toRepopulate.end(), delta, node->creatureType);
-                node->currentPopulation += delta;
-            }
-        }
-        return toRepopulate;
-    }
-};
-
-class Level_5 : public AquariumLevel  {
-public:
-    Level_5(int levelNumber, int targetScore)
-    : AquariumLevel(levelNumber, targetScore) {
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::NPCreature, 15)); // Increased from 10
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::BiggerFish, 10)); // Increased from 7
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::LurkerFish, 8)); // Increased from 5
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::RedFish, 5)); // Increased from 3
-        m_levelPopulation.push_back(std::make_shared<AquariumLevelPopulationNode>(AquariumCreatureType::Shark, 6)); // Increased from 4
-    }
-
-    std::vector<AquariumCreatureType> Repopulate() override {
-        std::vector<AquariumCreatureType> toRepopulate;
-        for (auto& node : m_levelPopulation) {
-            int delta = node->population - node->currentPopulation;
-            if (delta > 0) {
-                toRepopulate.insert(toRepopulate.end(), delta, node->creatureType);
-                node->currentPopulation += delta;
-            }
-        }
-        return toRepopulate;
-    }
-};
\ No newline at end of file
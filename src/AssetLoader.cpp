@@ -0,0 +1,145 @@
+#include "AssetLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+
+AssetLoader::AssetLoader(int threads) : m_threadCount(std::max(1, threads)) {}
+
+AssetLoader::~AssetLoader() {
+    m_nextImage = (int)m_images.size(); // workers stop after their current image
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+    if (m_bakeThread.joinable()) {
+        m_bakeThread.join();
+    }
+}
+
+void AssetLoader::addImage(const std::string& path, int width, int height, PixelsReady ready) {
+    m_images.push_back({path, width, height, std::move(ready)});
+}
+
+void AssetLoader::addStep(Step step) {
+    m_steps.push_back(std::move(step));
+}
+
+void AssetLoader::start() {
+    m_decoded.reserve(m_images.size());
+    m_finishing.reserve(m_images.size());
+    int misses = (int)m_images.size();
+    if (!m_cachePath.empty() && m_cache.open(m_cachePath)) {
+        for (int index = 0; index < (int)m_images.size(); ++index) {
+            ImageJob& job = m_images[index];
+            job.cached = m_cache.find(job.path, job.width, job.height, job.cachedImage);
+            misses -= job.cached ? 1 : 0;
+        }
+    }
+    if (!m_cachePath.empty()) {
+        ofLogNotice() << "Texture cache: " << m_images.size() - misses << " of " << m_images.size() << " images baked";
+    }
+    if (misses == 0) {
+        m_cachePath.clear(); // nothing to bake
+    }
+    int threads = std::min(m_threadCount, (int)m_images.size());
+    for (int i = 0; i < threads; ++i) {
+        m_threads.emplace_back(&AssetLoader::decodeLoop, this);
+    }
+}
+
+void AssetLoader::decodeLoop() {
+    for (int index = m_nextImage++; index < (int)m_images.size(); index = m_nextImage++) {
+        ImageJob& job = m_images[index];
+        if (job.cached) {
+            // a copy, so the mapping stays read-only and can be closed
+            const TextureCache::Image& image = job.cachedImage;
+            job.pixels.setFromPixels(image.pixels, image.width, image.height, OF_PIXELS_RGBA);
+            job.ok = true;
+        } else if ((job.ok = ofLoadImage(job.pixels, job.path))) {
+            job.pixels.setImageType(OF_IMAGE_COLOR_ALPHA);
+            if (job.width > 0 && job.height > 0) {
+                job.pixels.resize(job.width, job.height);
+            }
+        }
+        std::lock_guard<std::mutex> lock(m_decodedMutex);
+        m_decoded.push_back(index);
+    }
+}
+
+void AssetLoader::update(double budgetMillis) {
+    auto start = std::chrono::steady_clock::now();
+    auto spent = [start]() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(m_decodedMutex);
+        m_finishing.insert(m_finishing.end(), m_decoded.begin(), m_decoded.end());
+        m_decoded.clear();
+    }
+    size_t done = 0;
+    for (; done < m_finishing.size(); ++done) {
+        if (done > 0 && spent() >= budgetMillis) break;
+        ImageJob& job = m_images[m_finishing[done]];
+        if (job.ok) {
+            job.ready(job.pixels);
+            if (m_cachePath.empty()) {
+                job.pixels.clear(); // the texture has the pixels now
+            }
+        } else {
+            ofLogError() << "Failed to load image: " << job.path;
+        }
+        ++m_finished;
+    }
+    m_finishing.erase(m_finishing.begin(), m_finishing.begin() + done);
+
+    while (m_nextStep < m_steps.size() && (done == 0 || spent() < budgetMillis)) {
+        m_steps[m_nextStep++]();
+        ++m_finished;
+        ++done;
+    }
+
+    if (isDone() && m_cachePath.empty()) {
+        m_cache.close(); // every hit has been copied out
+    } else if (isDone() && !m_bakeThread.joinable()) {
+        // the decode workers are finished with the jobs; writing the file
+        // (full-size RGBA copies) stays off the main thread
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+        m_threads.clear();
+        m_bakeThread = std::thread(&AssetLoader::bakeCache, this);
+    }
+}
+
+void AssetLoader::bakeCache() {
+    m_cache.close();
+    std::vector<TextureCache::Image> images;
+    for (const ImageJob& job : m_images) {
+        if (job.ok) {
+            images.push_back({job.path, job.width, job.height, (int)job.pixels.getWidth(), (int)job.pixels.getHeight(), job.pixels.getData()});
+        }
+    }
+    if (TextureCache::write(m_cachePath, images)) {
+        ofLogNotice() << "Texture cache baked: " << images.size() << " images in " << m_cachePath;
+    } else {
+        ofLogError() << "Could not write texture cache " << m_cachePath;
+    }
+    for (ImageJob& job : m_images) {
+        job.pixels.clear();
+    }
+}
+
+void AssetLoader::finish() {
+    while (!isDone()) {
+        update(std::numeric_limits<double>::infinity());
+        if (!isDone()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1)); // workers still decoding
+        }
+    }
+}
+
+float AssetLoader::getProgress() const {
+    int total = getTotal();
+    return total == 0 ? 1.0f : (float)m_finished / total;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ofMain.h"
+#include "TextureCache.h"
+
+// Loads the game's assets in the background so the first frame does not wait
+// for them. Images are decoded (and resized) on worker threads; everything
+// that needs the GL context or the sound backend runs on the main thread from
+// update(), a few milliseconds' worth per frame:
+//
+//     loader.addImage("title.png", w, h, [banner](ofPixels& pixels) { banner->setPixels(pixels); });
+//     loader.addStep([this]() { font.load("Verdana.ttf", 12); });
+//     loader.start();
+//     ...
+//     loader.update(); // every frame until isDone()
+//
+// Images are decoded in the order they were added, so add what the intro
+// needs first. Everything must be added before start().
+//
+// With setCache, images found in the baked TextureCache are copied out of the
+// mapped file instead of decoded. If any image had to be decoded, the cache
+// is written again on a background thread once everything is loaded.
+class AssetLoader {
+public:
+    // Main thread; pixels are only lent (copy them to keep them). Not called
+    // when decoding failed.
+    using PixelsReady = std::function<void(ofPixels& pixels)>;
+    using Step = std::function<void()>;
+
+    explicit AssetLoader(int threads = 2);
+    ~AssetLoader();
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // width and height of 0 keep the image's own size.
+    void addImage(const std::string& path, int width, int height, PixelsReady ready);
+    void addStep(Step step);
+    void setCache(const std::string& cachePath) { m_cachePath = cachePath; }
+
+    void start();
+    // Finishes decoded images, then runs steps, until budgetMillis is spent
+    // (at least one item per call).
+    void update(double budgetMillis = 4.0);
+    // Loads everything before returning, as startup did before the loader;
+    // only there to compare the time to first frame.
+    void finish();
+
+    float getProgress() const;
+    bool isDone() const { return m_finished == getTotal(); }
+
+private:
+    struct ImageJob {
+        std::string path;
+        int width;
+        int height;
+        PixelsReady ready;
+        ofPixels pixels;
+        bool ok = false;
+        bool cached = false;
+        TextureCache::Image cachedImage;
+    };
+
+    void decodeLoop();
+    void bakeCache();
+    int getTotal() const { return (int)(m_images.size() + m_steps.size()); }
+
+    int m_threadCount;
+    std::vector<std::thread> m_threads;
+    std::vector<ImageJob> m_images;
+    std::vector<Step> m_steps;
+    std::atomic<int> m_nextImage{0};
+    std::mutex m_decodedMutex;
+    std::vector<int> m_decoded;  // images waiting for the main thread
+    std::vector<int> m_finishing; // update()'s copy of m_decoded
+    size_t m_nextStep = 0;
+    int m_finished = 0;
+    std::string m_cachePath;    // cleared when there is nothing to bake
+    TextureCache m_cache;
+    std::thread m_bakeThread;
+};
@@ -1,56 +1,141 @@
 #include "Core.h"
 
 
+// CreatureColumns
+int CreatureColumns::push(const CreatureState& state) {
+    x.push_back(state.x);
+    y.push_back(state.y);
+    dx.push_back(state.dx);
+    dy.push_back(state.dy);
+    speed.push_back(state.speed);
+    width.push_back(state.width);
+    height.push_back(state.height);
+    collisionRadius.push_back(state.collisionRadius);
+    value.push_back(state.value);
+    return size() - 1;
+}
+
+CreatureState CreatureColumns::read(int slot) const {
+    CreatureState state;
+    state.x = x[slot];
+    state.y = y[slot];
+    state.dx = dx[slot];
+    state.dy = dy[slot];
+    state.speed = speed[slot];
+    state.width = width[slot];
+    state.height = height[slot];
+    state.collisionRadius = collisionRadius[slot];
+    state.value = value[slot];
+    return state;
+}
+
+void CreatureColumns::swapRemove(int slot) {
+    int last = size() - 1;
+    if (slot != last) {
+        x[slot] = x[last];
+        y[slot] = y[last];
+        dx[slot] = dx[last];
+        dy[slot] = dy[last];
+        speed[slot] = speed[last];
+        width[slot] = width[last];
+        height[slot] = height[last];
+        collisionRadius[slot] = collisionRadius[last];
+        value[slot] = value[last];
+    }
+    x.pop_back();
+    y.pop_back();
+    dx.pop_back();
+    dy.pop_back();
+    speed.pop_back();
+    width.pop_back();
+    height.pop_back();
+    collisionRadius.pop_back();
+    value.pop_back();
+}
+
+void CreatureColumns::clear() {
+    x.clear();
+    y.clear();
+    dx.clear();
+    dy.clear();
+    speed.clear();
+    width.clear();
+    height.clear();
+    collisionRadius.clear();
+    value.clear();
+}
+
+
 // Creature Inherited Base Behavior
-void Creature::setBounds(int w, int h) { m_width = w; m_height = h; }
+void Creature::bindStorage(CreatureColumns* columns, int slot, CreatureHandle handle) {
+    m_columns = columns;
+    m_slot = slot;
+    m_handle = handle;
+}
+
+void Creature::unbindStorage() {
+    if (m_columns == nullptr) return;
+    m_state = m_columns->read(m_slot);
+    m_columns = nullptr;
+    m_slot = -1;
+}
+
+void Creature::setBounds(int w, int h) { boundW() = w; boundH() = h; }
 void Creature::normalize() {
-    float length = std::sqrt(m_dx * m_dx + m_dy * m_dy);
+    float& dx = dirX();
+    float& dy = dirY();
+    float length = std::sqrt(dx * dx + dy * dy);
     if (length != 0) {
-        m_dx /= length;
-        m_dy /= length;
+        dx /= length;
+        dy /= length;
     }
 }
 void Creature::moveBy(float dx, float dy) {
     // mueve y mantiene dentro de los bounds definidos con setBounds
-  m_x = ofClamp(m_x + dx, 0.f, m_width);
-  m_y = ofClamp(m_y + dy, 0.f, m_height);
+  posX() = ofClamp(posX() + dx, 0.f, boundW());
+  posY() = ofClamp(posY() + dy, 0.f, boundH());
 }
 void Creature::bounce() {
     // should implement boundary controls here
-
+    float& x = posX();
+    float& y = posY();
+    float& dx = dirX();
+    float& dy = dirY();
+    float width = boundW();
+    float height = boundH();
 
   bool hit = false;
 
     // Rebote en los bordes horizontales
-    if (m_x < 0.f) {
-        m_x = 0.f;
-        m_dx = std::abs(m_dx); // Cambia dirección a la derecha
+    if (x < 0.f) {
+        x = 0.f;
+        dx = std::abs(dx); // Cambia dirección a la derecha
         hit = true;
     }
-    else if (m_x > m_width) {
-        m_x = m_width;
-        m_dx = -std::abs(m_dx); // Cambia dirección a la izquierda
+    else if (x > width) {
+        x = width;
+        dx = -std::abs(dx); // Cambia dirección a la izquierda
         hit = true;
     }
 
     // Rebote en los bordes verticales
-    if (m_y < 0.f) {
-        m_y = 0.f;
-        m_dy = std::abs(m_dy); // Cambia dirección hacia abajo
+    if (y < 0.f) {
+        y = 0.f;
+        dy = std::abs(dy); // Cambia dirección hacia abajo
         hit = true;
     }
-    else if (m_y > m_height) {
-        m_y = m_height;
-        m_dy = -std::abs(m_dy); // Cambia dirección hacia arriba
+    else if (y > height) {
+        y = height;
+        dy = -std::abs(dy); // Cambia dirección hacia arriba
         hit = true;
     }
 
     // Normaliza dirección si hubo rebote
     if (hit) {
-        float len = std::sqrt(m_dx * m_dx + m_dy * m_dy);
+        float len = std::sqrt(dx * dx + dy * dy);
         if (len > 0.0001f) {
-            m_dx /= len;
-            m_dy /= len;
+            dx /= len;
+            dy /= len;
         }
     }
 }
@@ -60,43 +145,38 @@ void GameEvent::print() const {
         
         switch (type) {
             case GameEventType::NONE:
-                ofLogVerbose() << "No event." << std::endl;
+                AQ_LOG_VERBOSE("No event.");
                 break;
             case GameEventType::COLLISION:
-                ofLogVerbose() << "Collision event between creatures at (" 
-                << creatureA->getX() << ", " << creatureA->getY() << ") and ("
-                << creatureB->getX() << ", " << creatureB->getY() << ")." << std::endl;
+                AQ_LOG_VERBOSE("Collision event between creatures " << handleA.index << " and " << handleB.index << ".");
                 break;
             case GameEventType::CREATURE_ADDED:
-                ofLogVerbose() << "Creature added at (" 
-                << creatureA->getX() << ", " << creatureA->getY() << ")." << std::endl;
+                AQ_LOG_VERBOSE("Creature " << handleA.index << " added.");
                 break;
             case GameEventType::CREATURE_REMOVED:
-                ofLogVerbose() << "Creature removed at (" 
-                << creatureA->getX() << ", " << creatureA->getY() << ")." << std::endl;
+                AQ_LOG_VERBOSE("Creature " << handleB.index << " removed (value " << value << ").");
                 break;
             case GameEventType::GAME_OVER:
-                ofLogVerbose() << "Game Over event." << std::endl;
+                AQ_LOG_VERBOSE("Game Over event.");
                 break;
             case GameEventType::NEW_LEVEL:
-                ofLogVerbose() << "New Game level" << std::endl;
+                AQ_LOG_VERBOSE("New Game level");
                 break;
             default:
-                ofLogVerbose() << "Unknown event type." << std::endl;
+                AQ_LOG_VERBOSE("Unknown event type.");
                 break;
         }
 }
 
 // collision detection between two creatures
+bool checkCollision(const Creature& a, const Creature& b) {
+    return circlesOverlap(a.getX(), a.getY(), a.getCollisionRadius(),
+                          b.getX(), b.getY(), b.getCollisionRadius());
+}
+
 bool checkCollision(std::shared_ptr<Creature> a, std::shared_ptr<Creature> b) {
     if (!a || !b) return false;
-
-    float dx = a->getX() - b->getX();
-    float dy = a->getY() - b->getY();
-    float combinedRadius = a->getCollisionRadius() + b->getCollisionRadius();
-
-    // distancia^2 <= (r1+r2)^2  →  hay colisión
-    return (dx*dx + dy*dy) <= (combinedRadius * combinedRadius);
+    return checkCollision(*a, *b);
 }
 
 
@@ -110,38 +190,22 @@ string GameSceneKindToString(GameSceneKind t){
     return "";
 }
 
-std::shared_ptr<GameScene> GameSceneManager::GetScene(string name){
-    if(!this->HasScenes()){return nullptr;}
-    for(std::shared_ptr<GameScene> scene : this->m_scenes){
-        if(scene->GetName() == name){
-            return scene;
-        }
-    }
-    return nullptr;
-}
-
-void GameSceneManager::Transition(string name){
-    if(!this->HasScenes()){return;} // no need to do anything if nothing inside
-    std::shared_ptr<GameScene> newScene = this->GetScene(name);
+void GameSceneManager::Transition(GameSceneKind kind){
+    GameScene* newScene = this->GetScene(kind);
     if(newScene == nullptr){return;} // i dont have the scene so time to leave
-    if(newScene->GetName() == this->m_active_scene->GetName()){return;} // another do nothing since active scene is already pulled
-    this->m_active_scene = newScene; // now we keep it since this is a valid transition
-    return;
+    this->m_active_scene = newScene;
+    this->m_active_kind = kind;
 }
 
-void GameSceneManager::AddScene(std::shared_ptr<GameScene> newScene){
-    if(this->GetScene(newScene->GetName()) != nullptr){
+void GameSceneManager::AddScene(GameSceneKind kind, std::shared_ptr<GameScene> newScene){
+    if(newScene == nullptr || this->GetScene(kind) != nullptr){
         return; 
     }
-    this->m_scenes.push_back(newScene);
+    this->m_scenes[(int)kind] = std::move(newScene);
     if(m_active_scene == nullptr){
-        this->m_active_scene = newScene; 
+        this->m_active_scene = this->m_scenes[(int)kind].get();
+        this->m_active_kind = kind;
     }
-    return;
-}
-
-std::shared_ptr<GameScene> GameSceneManager::GetActiveScene(){
-    return this->m_active_scene;
 }
 
 string GameSceneManager::GetActiveSceneName(){
@@ -166,7 +230,21 @@ void GameIntroScene::Update(){
 }
 
 void GameIntroScene::Draw(){
-    this->m_banner->draw(0,0);
+    if (this->m_banner->isLoaded()) {
+        this->m_banner->draw(0,0);
+    }
+    if (!IsLoaded()) {
+        const float width = ofGetWidth() * 0.5f;
+        const float x = (ofGetWidth() - width) / 2;
+        const float y = ofGetHeight() - 60;
+        ofPushStyle();
+        ofNoFill();
+        ofSetColor(ofColor::white);
+        ofDrawRectangle(x, y, width, 12);
+        ofFill();
+        ofDrawRectangle(x + 2, y + 2, (width - 4) * m_loadProgress, 8);
+        ofPopStyle();
+    }
 }
 
 void GameOverScene::Update(){
@@ -1,13 +1,56 @@
 #pragma once
 #include <string>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <utility>
 #include <cmath>
 #include <algorithm>
-#include "ofMain.h" 
-
+#include "Platform.h"
+#include "SpriteAtlas.h"
+#include "Log.h"
+
+
+// The simulation steps at a fixed rate, independent of the render rate:
+// AQUARIUM_SIMULATION_HZ ticks a second, 60 unless the build defines it
+// (-DAQUARIUM_SIMULATION_HZ=120). Durations are written in seconds and
+// converted with SecondsToTicks; speeds are in pixels per 1/60 s and scaled
+// by kTickSpeedScale per tick.
+#ifndef AQUARIUM_SIMULATION_HZ
+#define AQUARIUM_SIMULATION_HZ 60
+#endif
+constexpr int kSimulationHz = AQUARIUM_SIMULATION_HZ;
+constexpr double kSimulationDt = 1.0 / kSimulationHz;
+constexpr float kTickSpeedScale = 60.0f / kSimulationHz;
+
+constexpr int SecondsToTicks(float seconds) {
+    return (int)(seconds * kSimulationHz + 0.5f);
+}
+
+// Fixed-timestep accumulator. Each rendered frame hands in the elapsed wall
+// time and gets back the number of simulation ticks to run; alpha() is how far
+// the frame sits between the last two ticks, for interpolated drawing.
+class SimulationClock {
+public:
+    static constexpr int kMaxTicksPerFrame = 8; // drop time after long stalls
+
+    int advance(double seconds) {
+        m_accumulator += seconds;
+        int ticks = (int)(m_accumulator / kSimulationDt);
+        if (ticks > kMaxTicksPerFrame) {
+            ticks = kMaxTicksPerFrame;
+            m_accumulator = 0.0;
+        } else {
+            m_accumulator -= ticks * kSimulationDt;
+        }
+        return ticks;
+    }
+    float alpha() const { return (float)(m_accumulator / kSimulationDt); }
+private:
+    double m_accumulator = 0.0;
+};
 
+// Counts simulation ticks.
 class AwaitFrames {
 public:
 	AwaitFrames(int frames) : m_frames(frames), m_counter(0) {}
@@ -26,66 +69,133 @@ private:
 
 class GameSprite {
 public:
-    GameSprite(const std::string& imagePath, int width, int height) {
-        if (!m_image.load(imagePath)) {
-            std::cerr << "Failed to load image: " << imagePath << std::endl;
-        }
-        m_image.resize(width, height);
-        m_flippedImage = m_image;
-        m_flippedImage.mirror(false, true); // Mirror horizontally
-    }
-
-    void draw(float x, float y) const {
-        // Apply the sprite tint color 
-        ofColor currentColor = ofGetStyle().color;
-        ofSetColor(currentColor.r * m_tintColor.r / 255.0f,
-                   currentColor.g * m_tintColor.g / 255.0f,
-                   currentColor.b * m_tintColor.b / 255.0f,
-                   currentColor.a * m_tintColor.a / 255.0f);
-        
-        if (m_flipped) {
-            m_flippedImage.draw(x, y);
-        } else {
-            m_image.draw(x, y);
+    // Standalone sprite owning its own image (title and game-over banners).
+    // Drawing it is a no-op until setPixels (images decoded in the
+    // background by the asset loader).
+    GameSprite() = default;
+    void setPixels(const ofPixels& pixels) { m_image.setFromPixels(pixels); }
+    bool isLoaded() const { return m_atlas != nullptr || m_image.isAllocated(); }
+
+    // Sprite drawing a region of a shared atlas. Only the flip and tint are
+    // per instance, so copies are cheap.
+    GameSprite(std::shared_ptr<const SpriteAtlas> atlas, int region)
+    : m_atlas(std::move(atlas)), m_region(region) {}
+
+    // The tint is the quad's vertex colour, as in SpriteBatch, and the flip
+    // mirrors its texture coordinates: one texture serves every colour and
+    // both directions, and the current colour is neither read nor changed.
+    void draw(float x, float y) const { draw(x, y, m_flipped, m_tintColor); }
+    void draw(float x, float y, bool flipped) const { draw(x, y, flipped, m_tintColor); }
+    void draw(float x, float y, bool flipped, const ofColor& tint) const {
+        if (m_atlas) {
+            m_atlas->drawRegion(m_region, x, y, flipped, tint);
+        } else if (m_image.isAllocated()) {
+            float w = m_image.getWidth();
+            float h = m_image.getHeight();
+            SpriteAtlas::drawSubsection(m_image.getTexture(), x, y, w, h, flipped ? w : 0, 0, flipped ? -w : w, h, tint);
         }
     }
 
     void setFlipped(bool flipped) { m_flipped = flipped; }
+    bool isFlipped() const { return m_flipped; }
     void setTintColor(const ofColor& color) { m_tintColor = color; }
+    const ofColor& getTintColor() const { return m_tintColor; }
+    const SpriteAtlas* getAtlas() const { return m_atlas.get(); }
+    int getRegion() const { return m_region; }
 
 private:
     ofImage m_image;
-    ofImage m_flippedImage;
+    std::shared_ptr<const SpriteAtlas> m_atlas;
+    int m_region = -1;
     bool m_flipped = false;
     ofColor m_tintColor = ofColor::white;
 };
 
 
 
+// Plain state of a creature. Lives inside the creature until it joins an
+// Aquarium, then is moved into the aquarium's CreatureColumns.
+struct CreatureState {
+    float x = 0.0f;
+    float y = 0.0f;
+    float dx = 0.0f;
+    float dy = 0.0f;
+    int speed = 0;
+    float width = 0.0f;  // movement bounds
+    float height = 0.0f;
+    float collisionRadius = 0.0f;
+    int value = 0;
+};
+
+// Structure-of-arrays storage for the state of many creatures, one row per
+// slot, so whole-tank passes walk contiguous memory.
+struct CreatureColumns {
+    std::vector<float> x, y, dx, dy;
+    std::vector<int> speed;
+    std::vector<float> width, height;
+    std::vector<float> collisionRadius;
+    std::vector<int> value;
+
+    int size() const { return (int)x.size(); }
+    int push(const CreatureState& state);
+    CreatureState read(int slot) const;
+    // Moves the last row into slot and drops the last row.
+    void swapRemove(int slot);
+    void clear();
+};
+
+// Stable reference to a creature stored in an aquarium: the index of its
+// handle slot plus the slot's generation when it was handed out. Removing the
+// creature bumps the generation, so old handles can be detected as stale.
+struct CreatureHandle {
+    int index = -1;
+    uint32_t generation = 0;
+
+    bool isNull() const { return index < 0; }
+    bool operator==(const CreatureHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const CreatureHandle& other) const { return !(*this == other); }
+};
+
+
 class Creature {
 protected:
     Creature(float x, float y, int speed, float collisionRadius, int value,
              std::shared_ptr<GameSprite> sprite)
-    : m_x(x)
-    , m_y(y)
-    , m_dx(0)
-    , m_dy(0)
-    , m_speed(speed)
-    , m_width(0)
-    , m_height(0)
-    , m_collisionRadius(collisionRadius)
-    , m_value(value)
-    , m_sprite(std::move(sprite)) {}
-
-    float m_x = 0.0f;
-    float m_y = 0.0f;
-    float m_dx = 0.0f;
-    float m_dy = 0.0f;
-    int m_speed = 0;
-    float m_width = 0.0f;
-    float m_height = 0.0f;
-    float m_collisionRadius = 0.0f;
-    int m_value = 0;
+    : m_sprite(std::move(sprite)) {
+        this->resetState(x, y, speed, collisionRadius, value);
+    }
+
+    // Back to a freshly constructed state; only valid while unbound.
+    void resetState(float x, float y, int speed, float collisionRadius, int value) {
+        m_state = CreatureState();
+        m_state.x = x;
+        m_state.y = y;
+        m_state.speed = speed;
+        m_state.collisionRadius = collisionRadius;
+        m_state.value = value;
+    }
+
+    // State accessors: they read the aquarium's columns once the creature is
+    // stored there, and the creature's own m_state otherwise.
+    float& posX() { return m_columns ? m_columns->x[m_slot] : m_state.x; }
+    float& posY() { return m_columns ? m_columns->y[m_slot] : m_state.y; }
+    float& dirX() { return m_columns ? m_columns->dx[m_slot] : m_state.dx; }
+    float& dirY() { return m_columns ? m_columns->dy[m_slot] : m_state.dy; }
+    int& speed() { return m_columns ? m_columns->speed[m_slot] : m_state.speed; }
+    float& boundW() { return m_columns ? m_columns->width[m_slot] : m_state.width; }
+    float& boundH() { return m_columns ? m_columns->height[m_slot] : m_state.height; }
+    float& radius() { return m_columns ? m_columns->collisionRadius[m_slot] : m_state.collisionRadius; }
+    int& value() { return m_columns ? m_columns->value[m_slot] : m_state.value; }
+    float posX() const { return m_columns ? m_columns->x[m_slot] : m_state.x; }
+    float posY() const { return m_columns ? m_columns->y[m_slot] : m_state.y; }
+    float dirX() const { return m_columns ? m_columns->dx[m_slot] : m_state.dx; }
+    float dirY() const { return m_columns ? m_columns->dy[m_slot] : m_state.dy; }
+    int speed() const { return m_columns ? m_columns->speed[m_slot] : m_state.speed; }
+    float radius() const { return m_columns ? m_columns->collisionRadius[m_slot] : m_state.collisionRadius; }
+    int value() const { return m_columns ? m_columns->value[m_slot] : m_state.value; }
+
     std::shared_ptr<GameSprite> m_sprite;
 
 public:
@@ -93,26 +203,51 @@ public:
     virtual void move() = 0;
     virtual void draw() const = 0;
 
-    virtual float getCollisionRadius() const { return m_collisionRadius; }
-    virtual void setCollisionRadius(float radius) { m_collisionRadius = radius; }
+    // Speed factor for creatures whose move() is a plain integrate-and-bounce,
+    // which lets the aquarium advance them straight from its columns.
+    // 0 means move() has its own logic and must be called.
+    virtual float linearSpeedScale() const { return 0.0f; }
 
-    float getX() const { return m_x; }
-    float getY() const { return m_y; }
-    int getSpeed() const { return m_speed; }
-    void setSpeed(int speed) { m_speed = speed; }
+    virtual float getCollisionRadius() const { return radius(); }
+    virtual void setCollisionRadius(float r) { radius() = r; }
+
+    float getX() const { return posX(); }
+    float getY() const { return posY(); }
+    int getSpeed() const { return speed(); }
+    void setSpeed(int s) { speed() = s; }
     void setFlipped(bool flipped) {
         if (m_sprite != nullptr) {
             m_sprite->setFlipped(flipped);
         }
     }
     void setSprite(std::shared_ptr<GameSprite> sprite) { m_sprite = std::move(sprite); }
-    int getValue() const { return m_value; }
-    void setValue(int value) { m_value = value; }
+    const std::shared_ptr<GameSprite>& getSprite() const { return m_sprite; }
+    // Size factor applied when drawing the sprite (see SpriteBatch)
+    virtual float getDrawScale() const { return 1.0f; }
+    int getValue() const { return value(); }
+    void setValue(int v) { value() = v; }
 
     void setBounds(int w, int h);
     void moveBy(float dx, float dy);
     void normalize();
     void bounce();
+
+    // Storage binding, used by Aquarium. Binding moves the state into the
+    // columns; unbinding copies it back so removed creatures stay readable.
+    void bindStorage(CreatureColumns* columns, int slot, CreatureHandle handle);
+    void rebindSlot(int slot) { m_slot = slot; }
+    void unbindStorage();
+    const CreatureState& localState() const { return m_state; }
+    // Row in the bound columns, -1 when not stored.
+    int getStorageSlot() const { return m_slot; }
+    // Handle from the last time the creature was stored; null if never.
+    CreatureHandle getHandle() const { return m_handle; }
+
+private:
+    CreatureState m_state;
+    CreatureColumns* m_columns = nullptr;
+    int m_slot = -1;
+    CreatureHandle m_handle;
 };
 
 // GameEvents
@@ -127,18 +262,20 @@ enum class GameEventType {
     GAME_EXIT,
     NEW_LEVEL,
 };
+constexpr int kGameEventTypeCount = (int)GameEventType::NEW_LEVEL + 1;
 
+// Plain value record, so events can be copied around and queued without
+// touching the heap. Creatures are referred to by handle: resolve them with
+// Aquarium::getCreature, which returns null once the creature is gone.
 class GameEvent {
     public:
-    GameEventType type;
-    std::shared_ptr<Creature> creatureA;
-    std::shared_ptr<Creature> creatureB; // For collision events
-    GameEvent() : type(GameEventType::NONE), creatureA(nullptr), creatureB(nullptr) {}
-    GameEvent(GameEventType t, std::shared_ptr<Creature> a , std::shared_ptr<Creature> b){
-        type = t;
-        creatureA = a;
-        creatureB = b;
-    }
+    GameEventType type = GameEventType::NONE;
+    CreatureHandle handleA;
+    CreatureHandle handleB; // For collision events
+    int value = 0;          // payload; see the publisher (score, lives, level...)
+    GameEvent() = default;
+    GameEvent(GameEventType t, CreatureHandle a = CreatureHandle(), CreatureHandle b = CreatureHandle(), int v = 0)
+    : type(t), handleA(a), handleB(b), value(v) {}
     
     // Additional methods can be added here
     bool isCollisionEvent() const { return type == GameEventType::COLLISION; }
@@ -158,6 +295,15 @@ class GameEvent {
 
 
 
+// distance^2 <= (r1+r2)^2, the narrowphase test shared by every collision path
+inline bool circlesOverlap(float ax, float ay, float ar, float bx, float by, float br) {
+    float dx = ax - bx;
+    float dy = ay - by;
+    float combinedRadius = ar + br;
+    return (dx*dx + dy*dy) <= (combinedRadius * combinedRadius);
+}
+
+bool checkCollision(const Creature& a, const Creature& b);
 bool checkCollision(std::shared_ptr<Creature> a, std::shared_ptr<Creature> b);
 
 
@@ -190,6 +336,7 @@ enum class GameSceneKind {
     AQUARIUM_GAME,
     GAME_OVER
 };
+constexpr int kGameSceneKindCount = (int)GameSceneKind::GAME_OVER + 1;
 
 string GameSceneKindToString(GameSceneKind t);
 
@@ -200,9 +347,13 @@ class GameIntroScene : public GameScene {
         string GetName() override {return this->m_name;}
         void Update() override;
         void Draw() override;
+        // Fraction of the assets loaded; a progress bar is drawn until it reaches 1.
+        void SetLoadProgress(float progress) { m_loadProgress = progress; }
+        bool IsLoaded() const { return m_loadProgress >= 1.0f; }
     private:
         string m_name;
         std::shared_ptr<GameSprite> m_banner;
+        float m_loadProgress = 1.0f;
 };
 
 class GameOverScene : public GameScene {
@@ -218,16 +369,25 @@ class GameOverScene : public GameScene {
 };
 
 
+// Scenes are stored by kind, so lookups and the active-scene checks done
+// every frame are an array index and a compare; nothing is allocated.
 class GameSceneManager {
     private:
-        std::vector<std::shared_ptr<GameScene>> m_scenes;
-        std::shared_ptr<GameScene> m_active_scene;
+        std::shared_ptr<GameScene> m_scenes[kGameSceneKindCount];
+        GameScene* m_active_scene = nullptr;
+        GameSceneKind m_active_kind = GameSceneKind::GAME_INTRO;
     public:
-        void Transition(string name);
-        void AddScene(std::shared_ptr<GameScene> newScene);
-        bool HasScenes(){return m_scenes.size() > 0; }
-        std::shared_ptr<GameScene> GetScene(string name);
-        std::shared_ptr<GameScene> GetActiveScene();
+        void Transition(GameSceneKind kind);
+        // The first scene added becomes the active one.
+        void AddScene(GameSceneKind kind, std::shared_ptr<GameScene> newScene);
+        bool HasScenes() const {return m_active_scene != nullptr; }
+        GameScene* GetScene(GameSceneKind kind) const { return m_scenes[(int)kind].get(); }
+        // Typed access for callers that know what they stored under kind.
+        template <typename T>
+        T* GetScene(GameSceneKind kind) const { return static_cast<T*>(GetScene(kind)); }
+        GameScene* GetActiveScene() const { return m_active_scene; }
+        GameSceneKind GetActiveSceneKind() const { return m_active_kind; }
+        bool IsActive(GameSceneKind kind) const { return m_active_scene != nullptr && m_active_kind == kind; }
         
         // support the functionality
         string GetActiveSceneName();
@@ -0,0 +1,39 @@
+#include "EventQueue.h"
+
+
+int EventQueue::subscribe(Subscriber subscriber) {
+    for (int id = 0; id < kMaxSubscribers; ++id) {
+        if (!m_subscribers[id]) {
+            m_subscribers[id] = std::move(subscriber);
+            return id;
+        }
+    }
+    return -1;
+}
+
+void EventQueue::unsubscribe(int id) {
+    if (id >= 0 && id < kMaxSubscribers) {
+        m_subscribers[id] = nullptr;
+    }
+}
+
+void EventQueue::publish(const GameEvent& event) {
+    if (m_count == kCapacity) {
+        m_head = (m_head + 1) % kCapacity;
+        --m_count;
+        ++m_dropped;
+    }
+    m_events[(m_head + m_count) % kCapacity] = event;
+    ++m_count;
+}
+
+void EventQueue::dispatch() {
+    for (int pending = m_count; pending > 0 && m_count > 0; --pending) {
+        GameEvent event = m_events[m_head]; // copied: a subscriber may publish
+        m_head = (m_head + 1) % kCapacity;
+        --m_count;
+        for (const Subscriber& subscriber : m_subscribers) {
+            if (subscriber) subscriber(event);
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <functional>
+#include "Core.h"
+
+// Fixed-capacity ring of GameEvents. The simulation publishes during its
+// ticks; dispatch() hands every pending event, oldest first, to each
+// subscriber (audio, HUD, telemetry...) and empties the ring, normally once
+// per frame. Nothing here allocates after subscribe(). When the ring is full
+// the oldest event is overwritten and counted in getDroppedCount().
+class EventQueue {
+public:
+    static constexpr int kCapacity = 256;
+    static constexpr int kMaxSubscribers = 8;
+    using Subscriber = std::function<void(const GameEvent&)>;
+
+    // Returns an id for unsubscribe, or -1 when every slot is taken.
+    int subscribe(Subscriber subscriber);
+    void unsubscribe(int id);
+
+    void publish(const GameEvent& event);
+    // Events published by a subscriber while dispatching wait for the next call.
+    void dispatch();
+    void clear() { m_head = 0; m_count = 0; }
+
+    int size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    const GameEvent& at(int i) const { return m_events[(m_head + i) % kCapacity]; } // 0 is the oldest
+    long long getDroppedCount() const { return m_dropped; }
+
+private:
+    GameEvent m_events[kCapacity];
+    int m_head = 0;
+    int m_count = 0;
+    long long m_dropped = 0;
+    Subscriber m_subscribers[kMaxSubscribers];
+};
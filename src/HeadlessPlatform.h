@@ -0,0 +1,178 @@
+#pragma once
+// Stand-ins for the part of openFrameworks the simulation code touches, used
+// when building with AQUARIUM_HEADLESS. Logging, clamping and random numbers
+// behave like openFrameworks; drawing, images and sounds do nothing, so the
+// simulation runs without a window or GL context.
+#include <string>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <algorithm>
+
+using namespace std; // matches what ofMain.h brings in
+
+// Logging
+enum ofLogLevel {
+    OF_LOG_VERBOSE,
+    OF_LOG_NOTICE,
+    OF_LOG_WARNING,
+    OF_LOG_ERROR,
+    OF_LOG_FATAL_ERROR,
+    OF_LOG_SILENT
+};
+
+inline ofLogLevel& headlessLogLevel() {
+    static ofLogLevel level = OF_LOG_NOTICE;
+    return level;
+}
+inline void ofSetLogLevel(ofLogLevel level) { headlessLogLevel() = level; }
+inline ofLogLevel ofGetLogLevel() { return headlessLogLevel(); }
+
+class ofLog {
+public:
+    explicit ofLog(ofLogLevel level = OF_LOG_NOTICE) : m_level(level) {}
+    ofLog(ofLogLevel level, const std::string& message) : m_level(level) { m_message << message; }
+    ~ofLog() {
+        if (m_level >= ofGetLogLevel() && m_level != OF_LOG_SILENT) {
+            std::cerr << m_message.str() << std::endl;
+        }
+    }
+    template <typename T>
+    ofLog& operator<<(const T& value) {
+        m_message << value;
+        return *this;
+    }
+    ofLog& operator<<(std::ostream& (*manip)(std::ostream&)) {
+        m_message << manip;
+        return *this;
+    }
+private:
+    ofLogLevel m_level;
+    std::ostringstream m_message;
+};
+
+class ofLogVerbose : public ofLog {
+public:
+    ofLogVerbose() : ofLog(OF_LOG_VERBOSE) {}
+    explicit ofLogVerbose(const std::string& message) : ofLog(OF_LOG_VERBOSE, message) {}
+};
+class ofLogNotice : public ofLog {
+public:
+    ofLogNotice() : ofLog(OF_LOG_NOTICE) {}
+    explicit ofLogNotice(const std::string& message) : ofLog(OF_LOG_NOTICE, message) {}
+};
+class ofLogWarning : public ofLog {
+public:
+    ofLogWarning() : ofLog(OF_LOG_WARNING) {}
+    explicit ofLogWarning(const std::string& message) : ofLog(OF_LOG_WARNING, message) {}
+};
+class ofLogError : public ofLog {
+public:
+    ofLogError() : ofLog(OF_LOG_ERROR) {}
+    explicit ofLogError(const std::string& message) : ofLog(OF_LOG_ERROR, message) {}
+};
+
+// Math and utilities
+inline float ofClamp(float value, float min, float max) {
+    return value < min ? min : (value > max ? max : value);
+}
+inline float ofRandom(float max) { return max * std::rand() / (RAND_MAX + 1.0f); }
+inline float ofRandom(float min, float max) { return min + ofRandom(max - min); }
+
+template <typename T>
+std::string ofToString(const T& value, int precision) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(precision) << value;
+    return out.str();
+}
+
+// Colours and style
+struct ofColor {
+    unsigned char r = 255, g = 255, b = 255, a = 255;
+    ofColor() = default;
+    ofColor(float r_, float g_, float b_, float a_ = 255)
+    : r((unsigned char)r_), g((unsigned char)g_), b((unsigned char)b_), a((unsigned char)a_) {}
+    static const ofColor white, black, red, green, blue, cyan, yellow, orange, purple;
+};
+inline const ofColor ofColor::white(255, 255, 255);
+inline const ofColor ofColor::black(0, 0, 0);
+inline const ofColor ofColor::red(255, 0, 0);
+inline const ofColor ofColor::green(0, 255, 0);
+inline const ofColor ofColor::blue(0, 0, 255);
+inline const ofColor ofColor::cyan(0, 255, 255);
+inline const ofColor ofColor::yellow(255, 255, 0);
+inline const ofColor ofColor::orange(255, 165, 0);
+inline const ofColor ofColor::purple(128, 0, 128);
+
+struct ofStyle {
+    ofColor color;
+};
+inline ofStyle ofGetStyle() { return ofStyle(); }
+
+// Drawing is a no-op
+inline void ofSetColor(const ofColor&) {}
+inline void ofSetColor(float, float, float, float = 255) {}
+inline void ofPushMatrix() {}
+inline void ofPopMatrix() {}
+inline void ofTranslate(float, float, float = 0) {}
+inline void ofScale(float, float, float = 1) {}
+inline void ofPushStyle() {}
+inline void ofPopStyle() {}
+inline void ofEnableAlphaBlending() {}
+inline void ofDisableAlphaBlending() {}
+inline void ofDrawBitmapString(const std::string&, float, float) {}
+inline void ofDrawCircle(float, float, float) {}
+inline void ofDrawRectangle(float, float, float, float) {}
+inline void ofFill() {}
+inline void ofNoFill() {}
+inline void ofBackgroundGradient(const ofColor&, const ofColor&) {}
+
+// No window: report the default window size
+inline int ofGetWidth() { return 1024; }
+inline int ofGetHeight() { return 768; }
+inline int ofGetWindowWidth() { return ofGetWidth(); }
+inline int ofGetWindowHeight() { return ofGetHeight(); }
+
+// No-op media
+class ofPixels {
+public:
+    int getWidth() const { return 0; }
+    int getHeight() const { return 0; }
+};
+
+class ofTexture {
+public:
+    void drawSubsection(float, float, float, float, float, float, float, float) const {}
+};
+
+class ofImage {
+public:
+    bool load(const std::string&) { return true; }
+    void setFromPixels(const ofPixels&) {}
+    void resize(int w, int h) { m_width = w; m_height = h; }
+    void mirror(bool, bool) {}
+    void draw(float, float) const {}
+    void draw(float, float, float, float) const {}
+    bool isAllocated() const { return false; }
+    float getWidth() const { return m_width; }
+    float getHeight() const { return m_height; }
+    const ofTexture& getTexture() const { return m_texture; }
+private:
+    int m_width = 0;
+    int m_height = 0;
+    ofTexture m_texture;
+};
+
+class ofSoundPlayer {
+public:
+    bool load(const std::string&, bool = false) { return true; }
+    void play() {}
+    void stop() {}
+    void setMultiPlay(bool) {}
+    void setVolume(float) {}
+    void setLoop(bool) {}
+    bool isLoaded() const { return false; }
+};
@@ -0,0 +1,126 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+
+JobSystem::JobSystem(int threads) {
+    threads = std::max(1, threads);
+    for (int i = 0; i < threads; ++i) {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+    for (int i = 1; i < threads; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+int JobSystem::chunkCount(int count, int grain) {
+    if (count <= 0) return 0;
+    grain = std::max(1, grain);
+    return std::min((count + grain - 1) / grain, kMaxChunks);
+}
+
+int JobSystem::chunkBegin(int chunk, int count, int grain) {
+    return (int)((long long)chunk * count / chunkCount(count, grain));
+}
+
+void JobSystem::run(int count, int grain, void (*invoke)(void*, int, int, int), void* context) {
+    const int chunks = chunkCount(count, grain);
+    if (chunks == 0) return;
+    if (chunks == 1 || m_workers.empty() || m_submitting.exchange(true, std::memory_order_acquire)) {
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            invoke(context, chunk, chunkBegin(chunk, count, grain), chunkBegin(chunk + 1, count, grain));
+        }
+        return;
+    }
+
+    Task task;
+    task.invoke = invoke;
+    task.context = context;
+    task.count = count;
+    task.grain = grain;
+    task.remaining.store(chunks, std::memory_order_relaxed);
+
+    const int threads = getThreadCount();
+    for (int t = 0; t < threads; ++t) {
+        Queue& queue = *m_queues[t];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.head == queue.tail) queue.head = queue.tail = 0;
+        for (int chunk = t; chunk < chunks; chunk += threads) {
+            queue.jobs[queue.tail % kMaxChunks] = {&task, chunk};
+            ++queue.tail;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    Job job;
+    while (popOrSteal(0, job)) {
+        execute(job);
+    }
+    // the last chunks may still be running on workers; task lives on this stack
+    while (task.remaining.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+    m_submitting.store(false, std::memory_order_release);
+}
+
+bool JobSystem::popOrSteal(int self, Job& job) {
+    {
+        Queue& own = *m_queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.tail != own.head) {
+            --own.tail;
+            job = own.jobs[own.tail % kMaxChunks];
+            return true;
+        }
+    }
+    const int threads = getThreadCount();
+    for (int i = 1; i < threads; ++i) {
+        Queue& victim = *m_queues[(self + i) % threads];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.tail != victim.head) {
+            job = victim.jobs[victim.head % kMaxChunks];
+            ++victim.head;
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::execute(const Job& job) {
+    Task& task = *job.task;
+    int begin = chunkBegin(job.chunk, task.count, task.grain);
+    int end = chunkBegin(job.chunk + 1, task.count, task.grain);
+    task.invoke(task.context, job.chunk, begin, end);
+    // last touch of the task: the caller may return as soon as this hits zero
+    task.remaining.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::workerLoop(int self) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop) return;
+            seen = m_generation;
+        }
+        Job job;
+        while (popOrSteal(self, job)) {
+            execute(job);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+// Fixed pool of worker threads for data-parallel loops over the tank.
+// parallelFor() cuts a range into chunks, deals them round-robin onto one
+// deque per thread and blocks until every chunk has run; the calling thread
+// works too. A thread pops its own deque from the back and, once that is
+// empty, steals from the front of the others, so uneven chunks even out.
+//
+// Chunk boundaries depend only on the range and the grain, never on the
+// thread count, and chunks must write disjoint data. Results are then the
+// same whichever thread ran which chunk. Nothing is allocated after
+// construction.
+//
+// One parallelFor is spread over the threads at a time. One started while
+// another is running (nested inside a chunk, say a tank's update inside
+// TankHost's loop over tanks, or from a second thread) runs all its chunks
+// on its own caller instead.
+class JobSystem {
+public:
+    static constexpr int kMaxChunks = 256;
+
+    // threads includes the caller, so JobSystem(1) runs everything inline.
+    explicit JobSystem(int threads = (int)std::thread::hardware_concurrency());
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    int getThreadCount() const { return (int)m_queues.size(); }
+
+    // Chunks parallelFor(count, grain, ...) splits into; size per-chunk
+    // scratch with this.
+    static int chunkCount(int count, int grain);
+    static int chunkBegin(int chunk, int count, int grain);
+
+    // Calls body(chunk, begin, end) for each chunk of [0, count). The range
+    // is split evenly into chunkCount(count, grain) chunks: at most grain
+    // items each, until the kMaxChunks cap is reached and chunks grow past
+    // grain. Size per-chunk scratch by chunkBegin, not by grain.
+    template <typename Body>
+    void parallelFor(int count, int grain, Body&& body) {
+        using BodyType = std::remove_reference_t<Body>;
+        run(count, grain, [](void* context, int chunk, int begin, int end) {
+            (*static_cast<BodyType*>(context))(chunk, begin, end);
+        }, const_cast<void*>(static_cast<const void*>(&body)));
+    }
+
+private:
+    struct Task {
+        void (*invoke)(void* context, int chunk, int begin, int end);
+        void* context;
+        int count;
+        int grain;
+        std::atomic<int> remaining;
+    };
+    struct Job {
+        Task* task;
+        int chunk;
+    };
+    struct Queue {
+        std::mutex mutex;
+        Job jobs[kMaxChunks];
+        int head = 0; // steal end
+        int tail = 0; // owner end
+    };
+
+    void run(int count, int grain, void (*invoke)(void*, int, int, int), void* context);
+    bool popOrSteal(int self, Job& job);
+    static void execute(const Job& job);
+    void workerLoop(int self);
+
+    std::vector<std::unique_ptr<Queue>> m_queues; // [0] belongs to the caller
+    std::vector<std::thread> m_workers;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    uint64_t m_generation = 0; // bumped under m_wakeMutex whenever work is posted
+    bool m_stop = false;
+    std::atomic<bool> m_submitting{false}; // a task is dealt onto the queues
+};
@@ -0,0 +1,225 @@
+#include "LevelLoader.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+
+namespace {
+
+bool fail(std::string& error, const std::string& text, size_t pos, const std::string& message) {
+    pos = std::min(pos, text.size());
+    int line = 1 + (int)std::count(text.begin(), text.begin() + pos, '\n');
+    error = "line " + std::to_string(line) + ": " + message;
+    return false;
+}
+
+bool isNameChar(char c) {
+    return std::isalnum((unsigned char)c) || c == '_' || c == '-' || c == ':' || c == '.';
+}
+
+void skipSpace(const std::string& text, size_t& pos) {
+    while (pos < text.size() && std::isspace((unsigned char)text[pos])) ++pos;
+}
+
+bool parseCount(const std::string& value, int& out) {
+    if (value.empty()) return false;
+    char* end = nullptr;
+    long parsed = std::strtol(value.c_str(), &end, 10);
+    if (*end != '\0' || parsed < 0 || parsed > 1000000) return false;
+    out = (int)parsed;
+    return true;
+}
+
+struct Attribute {
+    std::string name;
+    std::string value;
+};
+
+const std::string* findAttribute(const std::vector<Attribute>& attributes, const char* name) {
+    for (const Attribute& attribute : attributes) {
+        if (attribute.name == name) return &attribute.value;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+
+bool ParseLevelPack(const std::string& text, std::vector<AquariumLevelSpec>& levels, std::string& error) {
+    std::vector<AquariumLevelSpec> parsed;
+    std::vector<Attribute> attributes;
+    bool inLevel = false;
+    size_t pos = 0;
+    const size_t size = text.size();
+
+    while ((pos = text.find('<', pos)) != std::string::npos) {
+        const size_t start = pos;
+        if (text.compare(pos, 4, "<!--") == 0) {
+            size_t end = text.find("-->", pos + 4);
+            if (end == std::string::npos) return fail(error, text, start, "unterminated comment");
+            pos = end + 3;
+            continue;
+        }
+        if (text.compare(pos, 2, "<?") == 0 || text.compare(pos, 2, "<!") == 0) {
+            size_t end = text.find('>', pos);
+            if (end == std::string::npos) return fail(error, text, start, "unterminated declaration");
+            pos = end + 1;
+            continue;
+        }
+
+        ++pos;
+        bool closing = pos < size && text[pos] == '/';
+        if (closing) ++pos;
+        size_t nameStart = pos;
+        while (pos < size && isNameChar(text[pos])) ++pos;
+        std::string name = text.substr(nameStart, pos - nameStart);
+        if (name.empty()) return fail(error, text, start, "expected an element name after '<'");
+
+        attributes.clear();
+        bool selfClosing = false;
+        for (;;) {
+            skipSpace(text, pos);
+            if (pos >= size) return fail(error, text, start, "unterminated <" + name + ">");
+            if (text[pos] == '>') {
+                ++pos;
+                break;
+            }
+            if (text.compare(pos, 2, "/>") == 0) {
+                selfClosing = true;
+                pos += 2;
+                break;
+            }
+            size_t attrStart = pos;
+            while (pos < size && isNameChar(text[pos])) ++pos;
+            if (pos == attrStart) return fail(error, text, pos, "unexpected character in <" + name + ">");
+            Attribute attribute;
+            attribute.name = text.substr(attrStart, pos - attrStart);
+            skipSpace(text, pos);
+            if (pos >= size || text[pos] != '=') return fail(error, text, pos, "expected '=' after " + attribute.name);
+            ++pos;
+            skipSpace(text, pos);
+            if (pos >= size || (text[pos] != '"' && text[pos] != '\'')) {
+                return fail(error, text, pos, "expected a quoted value for " + attribute.name);
+            }
+            char quote = text[pos++];
+            size_t valueEnd = text.find(quote, pos);
+            if (valueEnd == std::string::npos) return fail(error, text, pos, "unterminated value for " + attribute.name);
+            attribute.value = text.substr(pos, valueEnd - pos);
+            pos = valueEnd + 1;
+            attributes.push_back(std::move(attribute));
+        }
+
+        if (closing) {
+            if (name == "level") {
+                if (!inLevel) return fail(error, text, start, "</level> without <level>");
+                inLevel = false;
+            }
+            continue;
+        }
+
+        if (name == "level") {
+            if (inLevel) return fail(error, text, start, "<level> inside another <level>");
+            const std::string* target = findAttribute(attributes, "target");
+            AquariumLevelSpec spec;
+            if (target == nullptr || !parseCount(*target, spec.targetScore)) {
+                return fail(error, text, start, "<level> needs a non-negative target=\"...\"");
+            }
+            parsed.push_back(std::move(spec));
+            inLevel = !selfClosing;
+        } else if (name == "fish") {
+            if (!inLevel) return fail(error, text, start, "<fish> outside a <level>");
+            const std::string* typeName = findAttribute(attributes, "type");
+            const std::string* count = findAttribute(attributes, "count");
+            AquariumCreatureType type;
+            int population = 0;
+            if (typeName == nullptr || !AquariumCreatureTypeFromString(*typeName, type)) {
+                return fail(error, text, start, "unknown fish type '" + (typeName ? *typeName : std::string()) + "'");
+            }
+            if (count == nullptr || !parseCount(*count, population)) {
+                return fail(error, text, start, "<fish> needs a non-negative count=\"...\"");
+            }
+            parsed.back().population.emplace_back(type, population);
+        }
+    }
+
+    if (inLevel) return fail(error, text, size, "missing </level>");
+    if (parsed.empty()) {
+        error = "no <level> elements";
+        return false;
+    }
+    levels = std::move(parsed);
+    return true;
+}
+
+bool LoadLevelPack(const std::string& path, std::vector<AquariumLevelSpec>& levels, std::string& error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    if (!ParseLevelPack(contents.str(), levels, error)) {
+        error = path + ", " + error;
+        return false;
+    }
+    return true;
+}
+
+const char* DefaultLevelPack() {
+    return
+        "<levels>"
+        "<level target=\"10\">"
+        "<fish type=\"NPCreature\" count=\"15\"/>"
+        "<fish type=\"ZigZagFish\" count=\"5\"/>"
+        "</level>"
+        "<level target=\"15\">"
+        "<fish type=\"NPCreature\" count=\"20\"/>"
+        "<fish type=\"ZigZagFish\" count=\"8\"/>"
+        "<fish type=\"LurkerFish\" count=\"3\"/>"
+        "<fish type=\"BlueFish\" count=\"5\"/>"
+        "</level>"
+        "<level target=\"20\">"
+        "<fish type=\"NPCreature\" count=\"25\"/>"
+        "<fish type=\"BiggerFish\" count=\"7\"/>"
+        "<fish type=\"ZigZagFish\" count=\"6\"/>"
+        "<fish type=\"LurkerFish\" count=\"5\"/>"
+        "<fish type=\"RedFish\" count=\"6\"/>"
+        "</level>"
+        "<level target=\"25\">"
+        "<fish type=\"NPCreature\" count=\"25\"/>"
+        "<fish type=\"ZigZagFish\" count=\"8\"/>"
+        "<fish type=\"LurkerFish\" count=\"6\"/>"
+        "<fish type=\"VioletFish\" count=\"5\"/>"
+        "</level>"
+        "<level target=\"35\">"
+        "<fish type=\"NPCreature\" count=\"20\"/>"
+        "<fish type=\"ZigZagFish\" count=\"10\"/>"
+        "<fish type=\"BiggerFish\" count=\"8\"/>"
+        "<fish type=\"BlueFish\" count=\"6\"/>"
+        "<fish type=\"Shark\" count=\"4\"/>"
+        "</level>"
+        "<level target=\"50\">"
+        "<fish type=\"NPCreature\" count=\"15\"/>"
+        "<fish type=\"BiggerFish\" count=\"10\"/>"
+        "<fish type=\"LurkerFish\" count=\"8\"/>"
+        "<fish type=\"RedFish\" count=\"5\"/>"
+        "<fish type=\"Shark\" count=\"6\"/>"
+        "</level>"
+        "</levels>";
+}
+
+std::vector<std::shared_ptr<AquariumLevel>> BuildAquariumLevels(const std::vector<AquariumLevelSpec>& levels) {
+    std::vector<std::shared_ptr<AquariumLevel>> built;
+    built.reserve(levels.size());
+    for (size_t i = 0; i < levels.size(); ++i) {
+        auto level = std::make_shared<AquariumLevel>((int)i, levels[i].targetScore);
+        for (const auto& entry : levels[i].population) {
+            level->addPopulation(entry.first, entry.second);
+        }
+        built.push_back(std::move(level));
+    }
+    return built;
+}
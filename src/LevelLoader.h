@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include "Aquarium.h"
+
+
+// One level of a campaign as written in the level file.
+struct AquariumLevelSpec {
+    int targetScore = 0;
+    std::vector<std::pair<AquariumCreatureType, int>> population;
+};
+
+// Reads the <level> elements of a level pack:
+//
+//   <levels>
+//       <level target="10">
+//           <fish type="NPCreature" count="15"/>
+//           <fish type="ZigZagFish" count="5"/>
+//       </level>
+//   </levels>
+//
+// Only this subset of XML is understood (elements, quoted attributes,
+// comments); anything outside <level> is skipped, so the pack can live in
+// settings.xml next to other settings. On failure returns false with a
+// message naming the line, and leaves levels untouched.
+bool ParseLevelPack(const std::string& text, std::vector<AquariumLevelSpec>& levels, std::string& error);
+bool LoadLevelPack(const std::string& path, std::vector<AquariumLevelSpec>& levels, std::string& error);
+
+// The built-in campaign, used when no level pack can be read.
+const char* DefaultLevelPack();
+
+// Fresh levels (no score, empty population) numbered in campaign order.
+std::vector<std::shared_ptr<AquariumLevel>> BuildAquariumLevels(const std::vector<AquariumLevelSpec>& levels);
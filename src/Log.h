@@ -0,0 +1,37 @@
+#pragma once
+#include "Platform.h"
+
+// Logging for the game loop. Messages below AQUARIUM_LOG_LEVEL are removed at
+// compile time, and the stream arguments are only evaluated when the message
+// also passes openFrameworks' runtime log level, so a filtered message costs
+// nothing to format.
+//
+//     AQ_LOG_NOTICE("Player lost a life! Lives remaining: " << m_lives);
+//
+// Release builds (NDEBUG) keep warnings and errors only; define
+// AQUARIUM_LOG_LEVEL to override.
+#define AQ_LOG_LEVEL_VERBOSE 0
+#define AQ_LOG_LEVEL_NOTICE  1
+#define AQ_LOG_LEVEL_WARNING 2
+#define AQ_LOG_LEVEL_ERROR   3
+#define AQ_LOG_LEVEL_SILENT  4
+
+#ifndef AQUARIUM_LOG_LEVEL
+    #ifdef NDEBUG
+        #define AQUARIUM_LOG_LEVEL AQ_LOG_LEVEL_WARNING
+    #else
+        #define AQUARIUM_LOG_LEVEL AQ_LOG_LEVEL_VERBOSE
+    #endif
+#endif
+
+#define AQ_LOG_AT(level, ofLevel, logger, ...) \
+    do { \
+        if constexpr ((level) >= AQUARIUM_LOG_LEVEL) { \
+            if (ofGetLogLevel() <= (ofLevel)) { logger() << __VA_ARGS__; } \
+        } \
+    } while (0)
+
+#define AQ_LOG_VERBOSE(...) AQ_LOG_AT(AQ_LOG_LEVEL_VERBOSE, OF_LOG_VERBOSE, ofLogVerbose, __VA_ARGS__)
+#define AQ_LOG_NOTICE(...)  AQ_LOG_AT(AQ_LOG_LEVEL_NOTICE, OF_LOG_NOTICE, ofLogNotice, __VA_ARGS__)
+#define AQ_LOG_WARNING(...) AQ_LOG_AT(AQ_LOG_LEVEL_WARNING, OF_LOG_WARNING, ofLogWarning, __VA_ARGS__)
+#define AQ_LOG_ERROR(...)   AQ_LOG_AT(AQ_LOG_LEVEL_ERROR, OF_LOG_ERROR, ofLogError, __VA_ARGS__)
@@ -0,0 +1,165 @@
+#include "MovementKernel.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AQUARIUM_KERNEL_SSE2 1
+#include <immintrin.h>
+#endif
+
+
+void moveLinearCreaturesScalar(CreatureColumns& c, const std::vector<float>& moveScale, int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        if (moveScale[i] == 0.0f) continue;
+        float step = c.speed[i] * moveScale[i];
+        float x = c.x[i] + c.dx[i] * step;
+        float y = c.y[i] + c.dy[i] * step;
+        float dx = c.dx[i];
+        float dy = c.dy[i];
+
+        bool hit = false;
+        if (x < 0.f) { x = 0.f; dx = std::abs(dx); hit = true; }
+        else if (x > c.width[i]) { x = c.width[i]; dx = -std::abs(dx); hit = true; }
+        if (y < 0.f) { y = 0.f; dy = std::abs(dy); hit = true; }
+        else if (y > c.height[i]) { y = c.height[i]; dy = -std::abs(dy); hit = true; }
+        if (hit) {
+            float len = std::sqrt(dx * dx + dy * dy);
+            if (len > 0.0001f) {
+                dx /= len;
+                dy /= len;
+            }
+        }
+
+        c.x[i] = x;
+        c.y[i] = y;
+        c.dx[i] = dx;
+        c.dy[i] = dy;
+    }
+}
+
+
+#if defined(__AVX__)
+
+static int moveLinearCreaturesWide(CreatureColumns& c, const std::vector<float>& moveScale, int begin, int end) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 minLen = _mm256_set1_ps(0.0001f);
+    int i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 scale = _mm256_loadu_ps(&moveScale[i]);
+        __m256 active = _mm256_cmp_ps(scale, zero, _CMP_NEQ_UQ);
+        if (_mm256_movemask_ps(active) == 0) continue;
+
+        __m256 x0 = _mm256_loadu_ps(&c.x[i]);
+        __m256 y0 = _mm256_loadu_ps(&c.y[i]);
+        __m256 dx0 = _mm256_loadu_ps(&c.dx[i]);
+        __m256 dy0 = _mm256_loadu_ps(&c.dy[i]);
+        __m256 w = _mm256_loadu_ps(&c.width[i]);
+        __m256 h = _mm256_loadu_ps(&c.height[i]);
+        __m256 speed = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&c.speed[i])));
+
+        __m256 step = _mm256_mul_ps(speed, scale);
+        __m256 x = _mm256_add_ps(x0, _mm256_mul_ps(dx0, step));
+        __m256 y = _mm256_add_ps(y0, _mm256_mul_ps(dy0, step));
+
+        // same if / else-if order as the scalar bounce
+        __m256 loX = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+        __m256 hiX = _mm256_andnot_ps(loX, _mm256_cmp_ps(x, w, _CMP_GT_OQ));
+        __m256 loY = _mm256_cmp_ps(y, zero, _CMP_LT_OQ);
+        __m256 hiY = _mm256_andnot_ps(loY, _mm256_cmp_ps(y, h, _CMP_GT_OQ));
+
+        __m256 absDx = _mm256_andnot_ps(sign, dx0);
+        __m256 absDy = _mm256_andnot_ps(sign, dy0);
+        x = _mm256_blendv_ps(_mm256_blendv_ps(x, w, hiX), zero, loX);
+        y = _mm256_blendv_ps(_mm256_blendv_ps(y, h, hiY), zero, loY);
+        __m256 dx = _mm256_blendv_ps(_mm256_blendv_ps(dx0, _mm256_or_ps(absDx, sign), hiX), absDx, loX);
+        __m256 dy = _mm256_blendv_ps(_mm256_blendv_ps(dy0, _mm256_or_ps(absDy, sign), hiY), absDy, loY);
+
+        // walls are rare, only pay for sqrt/div when a lane hit one
+        __m256 hit = _mm256_and_ps(active, _mm256_or_ps(_mm256_or_ps(loX, hiX), _mm256_or_ps(loY, hiY)));
+        if (_mm256_movemask_ps(hit) != 0) {
+            __m256 len = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+            __m256 renorm = _mm256_and_ps(hit, _mm256_cmp_ps(len, minLen, _CMP_GT_OQ));
+            dx = _mm256_blendv_ps(dx, _mm256_div_ps(dx, len), renorm);
+            dy = _mm256_blendv_ps(dy, _mm256_div_ps(dy, len), renorm);
+        }
+
+        _mm256_storeu_ps(&c.x[i], _mm256_blendv_ps(x0, x, active));
+        _mm256_storeu_ps(&c.y[i], _mm256_blendv_ps(y0, y, active));
+        _mm256_storeu_ps(&c.dx[i], _mm256_blendv_ps(dx0, dx, active));
+        _mm256_storeu_ps(&c.dy[i], _mm256_blendv_ps(dy0, dy, active));
+    }
+    return i;
+}
+
+#elif defined(AQUARIUM_KERNEL_SSE2)
+
+// SSE2 has no blendv, select with and/andnot/or
+static inline __m128 select(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static int moveLinearCreaturesWide(CreatureColumns& c, const std::vector<float>& moveScale, int begin, int end) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 minLen = _mm_set1_ps(0.0001f);
+    int i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128 scale = _mm_loadu_ps(&moveScale[i]);
+        __m128 active = _mm_cmpneq_ps(scale, zero);
+        if (_mm_movemask_ps(active) == 0) continue;
+
+        __m128 x0 = _mm_loadu_ps(&c.x[i]);
+        __m128 y0 = _mm_loadu_ps(&c.y[i]);
+        __m128 dx0 = _mm_loadu_ps(&c.dx[i]);
+        __m128 dy0 = _mm_loadu_ps(&c.dy[i]);
+        __m128 w = _mm_loadu_ps(&c.width[i]);
+        __m128 h = _mm_loadu_ps(&c.height[i]);
+        __m128 speed = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&c.speed[i])));
+
+        __m128 step = _mm_mul_ps(speed, scale);
+        __m128 x = _mm_add_ps(x0, _mm_mul_ps(dx0, step));
+        __m128 y = _mm_add_ps(y0, _mm_mul_ps(dy0, step));
+
+        // same if / else-if order as the scalar bounce
+        __m128 loX = _mm_cmplt_ps(x, zero);
+        __m128 hiX = _mm_andnot_ps(loX, _mm_cmpgt_ps(x, w));
+        __m128 loY = _mm_cmplt_ps(y, zero);
+        __m128 hiY = _mm_andnot_ps(loY, _mm_cmpgt_ps(y, h));
+
+        __m128 absDx = _mm_andnot_ps(sign, dx0);
+        __m128 absDy = _mm_andnot_ps(sign, dy0);
+        x = select(loX, zero, select(hiX, w, x));
+        y = select(loY, zero, select(hiY, h, y));
+        __m128 dx = select(loX, absDx, select(hiX, _mm_or_ps(absDx, sign), dx0));
+        __m128 dy = select(loY, absDy, select(hiY, _mm_or_ps(absDy, sign), dy0));
+
+        // walls are rare, only pay for sqrt/div when a lane hit one
+        __m128 hit = _mm_and_ps(active, _mm_or_ps(_mm_or_ps(loX, hiX), _mm_or_ps(loY, hiY)));
+        if (_mm_movemask_ps(hit) != 0) {
+            __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+            __m128 renorm = _mm_and_ps(hit, _mm_cmpgt_ps(len, minLen));
+            dx = select(renorm, _mm_div_ps(dx, len), dx);
+            dy = select(renorm, _mm_div_ps(dy, len), dy);
+        }
+
+        _mm_storeu_ps(&c.x[i], select(active, x, x0));
+        _mm_storeu_ps(&c.y[i], select(active, y, y0));
+        _mm_storeu_ps(&c.dx[i], select(active, dx, dx0));
+        _mm_storeu_ps(&c.dy[i], select(active, dy, dy0));
+    }
+    return i;
+}
+
+#else
+
+static int moveLinearCreaturesWide(CreatureColumns&, const std::vector<float>&, int begin, int) {
+    return begin;
+}
+
+#endif
+
+
+void moveLinearCreatures(CreatureColumns& columns, const std::vector<float>& moveScale, int begin, int end) {
+    int done = moveLinearCreaturesWide(columns, moveScale, begin, end);
+    moveLinearCreaturesScalar(columns, moveScale, done, end);
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <vector>
+#include "Core.h"
+
+
+// Integrate-and-bounce for the linear movers stored in a set of creature
+// columns: rows with a non-zero moveScale advance by dx/dy * speed * scale and
+// reflect off their bounds, exactly like NPCreature::move() + Creature::bounce().
+// Rows with scale 0 are left untouched. Works on [begin, end).
+//
+// Uses SSE2 (or AVX when the build enables it) with a scalar tail. The vector
+// and scalar paths produce bit-identical results; keep the build free of
+// floating point contraction (-ffp-contract=off) so the scalar reference
+// does not turn into fused multiply-adds.
+void moveLinearCreatures(CreatureColumns& columns, const std::vector<float>& moveScale, int begin, int end);
+
+// Plain per-row version, also the tail of the vector loop.
+void moveLinearCreaturesScalar(CreatureColumns& columns, const std::vector<float>& moveScale, int begin, int end);
@@ -0,0 +1,9 @@
+#pragma once
+// The one place the game picks its platform layer: openFrameworks for the
+// game, or a no-op stand-in for the headless simulation build
+// (see headless/Makefile).
+#ifdef AQUARIUM_HEADLESS
+#include "HeadlessPlatform.h"
+#else
+#include "ofMain.h"
+#endif
@@ -0,0 +1,127 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+
+namespace {
+
+struct TraceEvent {
+    int scope;
+    int64_t start;
+    int64_t duration;
+};
+
+// Registration can happen on any thread (the first time a scope is reached);
+// everything else is only touched by the recording thread.
+std::mutex g_registerMutex;
+const char* g_names[Profiler::kMaxScopes];
+int g_scopeCount = 0;
+bool g_enabled = false;
+
+int64_t g_frameMicros[Profiler::kHistoryFrames][Profiler::kMaxScopes];
+int g_frameCalls[Profiler::kHistoryFrames][Profiler::kMaxScopes];
+int g_row = 0;
+int g_rowsFilled = 0;
+
+TraceEvent g_events[Profiler::kMaxEvents];
+int g_eventHead = 0;   // next slot to write
+int g_eventCount = 0;
+
+std::vector<double> g_sortScratch;
+
+} // namespace
+
+thread_local bool Profiler::t_recording = false;
+
+void Profiler::setEnabled(bool enabled) {
+    if (enabled && !g_enabled) {
+        std::memset(g_frameMicros, 0, sizeof(g_frameMicros));
+        std::memset(g_frameCalls, 0, sizeof(g_frameCalls));
+        g_row = 0;
+        g_rowsFilled = 1;
+        g_eventHead = 0;
+        g_eventCount = 0;
+        g_sortScratch.reserve(kHistoryFrames);
+    }
+    g_enabled = enabled;
+    t_recording = enabled;
+}
+
+bool Profiler::isEnabled() {
+    return g_enabled;
+}
+
+int Profiler::registerScope(const char* name) {
+    std::lock_guard<std::mutex> lock(g_registerMutex);
+    for (int i = 0; i < g_scopeCount; ++i) {
+        if (std::strcmp(g_names[i], name) == 0) return i;
+    }
+    if (g_scopeCount == kMaxScopes) return kMaxScopes - 1; // shares the last slot
+    g_names[g_scopeCount] = name;
+    return g_scopeCount++;
+}
+
+void Profiler::beginFrame() {
+    if (!t_recording) return;
+    g_row = (g_row + 1) % kHistoryFrames;
+    g_rowsFilled = std::min(g_rowsFilled + 1, kHistoryFrames);
+    std::memset(g_frameMicros[g_row], 0, sizeof(g_frameMicros[g_row]));
+    std::memset(g_frameCalls[g_row], 0, sizeof(g_frameCalls[g_row]));
+}
+
+void Profiler::record(int scope, int64_t startMicros, int64_t endMicros) {
+    int64_t duration = endMicros - startMicros;
+    g_frameMicros[g_row][scope] += duration;
+    g_frameCalls[g_row][scope] += 1;
+
+    g_events[g_eventHead] = {scope, startMicros, duration};
+    g_eventHead = (g_eventHead + 1) % kMaxEvents;
+    g_eventCount = std::min(g_eventCount + 1, kMaxEvents);
+}
+
+void Profiler::getStats(std::vector<ScopeStats>& out) {
+    out.clear();
+    int scopes;
+    {
+        std::lock_guard<std::mutex> lock(g_registerMutex);
+        scopes = g_scopeCount;
+    }
+    for (int scope = 0; scope < scopes; ++scope) {
+        g_sortScratch.clear();
+        for (int i = 0; i < g_rowsFilled; ++i) {
+            if (g_frameCalls[i][scope] > 0) {
+                g_sortScratch.push_back(g_frameMicros[i][scope] / 1000.0);
+            }
+        }
+        if (g_sortScratch.empty()) continue;
+        std::sort(g_sortScratch.begin(), g_sortScratch.end());
+        double sum = 0.0;
+        for (double ms : g_sortScratch) sum += ms;
+        int n = (int)g_sortScratch.size();
+        int p99 = std::max(0, (int)std::ceil(0.99 * n) - 1);
+        out.push_back({g_names[scope], n, g_sortScratch.front(), sum / n, g_sortScratch[p99]});
+    }
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+    std::ofstream file(path);
+    if (!file) return false;
+    int first = (g_eventHead - g_eventCount + kMaxEvents) % kMaxEvents;
+    int64_t origin = g_eventCount > 0 ? g_events[first].start : 0;
+    for (int i = 1; i < g_eventCount; ++i) {
+        origin = std::min(origin, g_events[(first + i) % kMaxEvents].start);
+    }
+
+    file << "{\"traceEvents\":[";
+    for (int i = 0; i < g_eventCount; ++i) {
+        const TraceEvent& event = g_events[(first + i) % kMaxEvents];
+        file << (i ? ",\n" : "\n") << "{\"name\":\"" << g_names[event.scope]
+             << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << event.start - origin
+             << ",\"dur\":" << event.duration << "}";
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return (bool)file;
+}
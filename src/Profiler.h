@@ -0,0 +1,89 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Scoped frame timers. Put a scope at the top of a block:
+//
+//     void Aquarium::draw() const {
+//         AQ_PROFILE_SCOPE("Aquarium::draw");
+//         ...
+//
+// Each scope records its start and duration into a ring buffer of trace
+// events, and adds its time to the current frame's row of a per-scope history
+// used for the min/avg/p99 overlay. Only the thread that called
+// Profiler::setEnabled(true) records, so scopes reached from job system
+// workers stay silent. While disabled a scope costs a thread-local bool test;
+// build with AQUARIUM_PROFILER=0 to compile the scopes out entirely.
+#ifndef AQUARIUM_PROFILER
+#define AQUARIUM_PROFILER 1
+#endif
+
+class Profiler {
+public:
+    static constexpr int kMaxScopes = 32;
+    static constexpr int kHistoryFrames = 240;
+    static constexpr int kMaxEvents = 1 << 16;
+
+    struct ScopeStats {
+        const char* name;
+        int frames;     // frames of the history the scope ran in
+        double minMs;
+        double avgMs;
+        double p99Ms;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+    static bool isRecording() { return t_recording; }
+
+    // Once per callsite (AQ_PROFILE_SCOPE keeps the id in a static).
+    static int registerScope(const char* name);
+
+    // Frame boundary: closes the current history row and starts the next.
+    static void beginFrame();
+
+    static int64_t nowMicros() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    static void record(int scope, int64_t startMicros, int64_t endMicros);
+
+    // Per-scope statistics over the frame history, in registration order;
+    // out is reused.
+    static void getStats(std::vector<ScopeStats>& out);
+    // The trace events still in the ring buffer, as Chrome trace JSON
+    // (chrome://tracing, Perfetto). False if the file cannot be written.
+    static bool writeChromeTrace(const std::string& path);
+
+private:
+    static thread_local bool t_recording;
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(int scope) : m_scope(scope), m_start(Profiler::isRecording() ? Profiler::nowMicros() : -1) {}
+    ~ProfileScope() {
+        if (m_start >= 0 && Profiler::isRecording()) {
+            Profiler::record(m_scope, m_start, Profiler::nowMicros());
+        }
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int m_scope;
+    int64_t m_start;
+};
+
+#define AQ_PROFILE_CONCAT_(a, b) a##b
+#define AQ_PROFILE_CONCAT(a, b) AQ_PROFILE_CONCAT_(a, b)
+
+#if AQUARIUM_PROFILER
+#define AQ_PROFILE_SCOPE(name) \
+    static const int AQ_PROFILE_CONCAT(aqProfileId, __LINE__) = Profiler::registerScope(name); \
+    ProfileScope AQ_PROFILE_CONCAT(aqProfileScope, __LINE__)(AQ_PROFILE_CONCAT(aqProfileId, __LINE__))
+#else
+#define AQ_PROFILE_SCOPE(name) do {} while (0)
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+
+
+// PCG32 (O'Neill, pcg-random.org): 64-bit state, 32-bit output. Each tank
+// owns one, so spawning and behaviour replay exactly for a given seed and
+// tanks never share generator state.
+class RandomGenerator {
+public:
+    explicit RandomGenerator(uint64_t seed = 0x853c49e6748fea9bULL) { this->seed(seed); }
+
+    void seed(uint64_t seed) {
+        m_state = 0;
+        next();
+        m_state += seed;
+        next();
+    }
+
+    uint32_t next() {
+        uint64_t old = m_state;
+        m_state = old * 6364136223846793005ULL + kIncrement;
+        uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u);
+        uint32_t rot = (uint32_t)(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+    }
+
+    // Uniform in [0, bound) by multiply-shift; bound must be positive.
+    int nextInt(int bound) {
+        return (int)(((uint64_t)next() * (uint32_t)bound) >> 32);
+    }
+
+    // Uniform in [0, 1).
+    float nextFloat() {
+        return (next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Uniform in [lo, hi).
+    float range(float lo, float hi) {
+        return lo + (hi - lo) * nextFloat();
+    }
+
+private:
+    static constexpr uint64_t kIncrement = 1442695040888963407ULL;
+    uint64_t m_state;
+};
@@ -0,0 +1,45 @@
+#include "ScrollingBackground.h"
+
+
+ScrollingBackground::ScrollingBackground() {
+    m_quad.setMode(OF_PRIMITIVE_TRIANGLE_STRIP);
+    for (int i = 0; i < 4; ++i) {
+        m_quad.addVertex(glm::vec3(0, 0, 0));
+        m_quad.addTexCoord(glm::vec2(0, 0));
+    }
+    resize(1, 1); // until the window's size is known
+}
+
+void ScrollingBackground::addLayer(const ofPixels& pixels, float parallax) {
+    m_layers.emplace_back();
+    Layer& layer = m_layers.back();
+    layer.parallax = parallax;
+    layer.texture.allocate(pixels, false); // normalized coordinates, so GL_REPEAT works
+    layer.texture.setTextureWrap(GL_REPEAT, GL_REPEAT);
+}
+
+void ScrollingBackground::resize(int width, int height) {
+    m_size = glm::vec2(std::max(1, width), std::max(1, height));
+    m_quad.setVertex(0, glm::vec3(0, 0, 0));
+    m_quad.setVertex(1, glm::vec3(m_size.x, 0, 0));
+    m_quad.setVertex(2, glm::vec3(0, m_size.y, 0));
+    m_quad.setVertex(3, glm::vec3(m_size.x, m_size.y, 0));
+}
+
+void ScrollingBackground::draw(const glm::vec2& scroll) {
+    if (m_layers.empty()) return;
+    ofPushStyle();
+    ofSetColor(ofColor::white);
+    for (Layer& layer : m_layers) {
+        glm::vec2 uv = -scroll * layer.parallax / m_size;
+        uv -= glm::floor(uv); // keep the coordinates small as the scroll grows
+        m_quad.setTexCoord(0, uv);
+        m_quad.setTexCoord(1, uv + glm::vec2(1, 0));
+        m_quad.setTexCoord(2, uv + glm::vec2(0, 1));
+        m_quad.setTexCoord(3, uv + glm::vec2(1, 1));
+        layer.texture.bind();
+        m_quad.draw();
+        layer.texture.unbind();
+    }
+    ofPopStyle();
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <vector>
+#include "ofMain.h"
+
+// The scrolling backdrop as one window-sized quad per layer. Each layer's
+// texture is a plain 2D texture (not ARB rectangle) with GL_REPEAT wrapping
+// and spans the window once; scrolling only moves the quad's texture
+// coordinates, so a layer costs one draw call and a resize only moves the
+// quad's corners. Layers draw in the order added; a layer's parallax scales
+// the scroll offset (1 moves with it, 0.5 at half speed for a far layer).
+class ScrollingBackground {
+public:
+    ScrollingBackground();
+
+    void addLayer(const ofPixels& pixels, float parallax = 1.0f);
+    bool isLoaded() const { return !m_layers.empty(); }
+    void resize(int width, int height);
+
+    // scroll is in window pixels; the art moves right and down as it grows.
+    void draw(const glm::vec2& scroll);
+
+private:
+    struct Layer {
+        ofTexture texture;
+        float parallax;
+    };
+
+    std::vector<Layer> m_layers;
+    ofMesh m_quad;
+    glm::vec2 m_size;
+};
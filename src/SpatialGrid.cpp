@@ -0,0 +1,93 @@
+#include "SpatialGrid.h"
+#include "JobSystem.h"
+
+// below this many creatures per chunk the parallel rebuild is not worth it
+static constexpr int kRebuildGrain = 4096;
+
+
+void SpatialGrid::rebuild(const CreatureColumns& creatures, int width, int height, JobSystem* jobs) {
+    m_cols = std::max(1, static_cast<int>(std::ceil(width / m_cellSize)));
+    m_rows = std::max(1, static_cast<int>(std::ceil(height / m_cellSize)));
+    m_maxRadius = 0.0f;
+
+    m_cellStart.assign(m_cols * m_rows + 1, 0);
+    m_cellOf.resize(creatures.size());
+    m_entries.resize(creatures.size());
+
+    if (jobs != nullptr && jobs->getThreadCount() > 1 && JobSystem::chunkCount(creatures.size(), kRebuildGrain) > 1) {
+        rebuildChunked(creatures, *jobs);
+        return;
+    }
+
+    // count creatures per cell
+    for (int i = 0; i < creatures.size(); ++i) {
+        int cell = cellCoord(creatures.y[i], m_rows) * m_cols + cellCoord(creatures.x[i], m_cols);
+        m_cellOf[i] = cell;
+        m_cellStart[cell + 1]++;
+        m_maxRadius = std::max(m_maxRadius, creatures.collisionRadius[i]);
+    }
+
+    // prefix sum turns counts into start offsets
+    for (size_t c = 1; c < m_cellStart.size(); ++c) {
+        m_cellStart[c] += m_cellStart[c - 1];
+    }
+
+    // scatter in index order; each cell's offset doubles as its write cursor
+    for (int i = 0; i < creatures.size(); ++i) {
+        m_entries[m_cellStart[m_cellOf[i]]++] = i;
+    }
+    // the cursors now sit at the start of the following cell, shift them back
+    for (size_t c = m_cellStart.size() - 2; c > 0; --c) {
+        m_cellStart[c] = m_cellStart[c - 1];
+    }
+    m_cellStart[0] = 0;
+}
+
+void SpatialGrid::rebuildChunked(const CreatureColumns& creatures, JobSystem& jobs) {
+    const int cells = m_cols * m_rows;
+    const int chunks = JobSystem::chunkCount(creatures.size(), kRebuildGrain);
+    m_chunkCells.assign(chunks * cells, 0);
+    m_chunkMaxRadius.assign(chunks, 0.0f);
+
+    jobs.parallelFor(creatures.size(), kRebuildGrain, [&](int chunk, int begin, int end) {
+        int* counts = &m_chunkCells[chunk * cells];
+        float maxRadius = 0.0f;
+        for (int i = begin; i < end; ++i) {
+            int cell = cellCoord(creatures.y[i], m_rows) * m_cols + cellCoord(creatures.x[i], m_cols);
+            m_cellOf[i] = cell;
+            counts[cell]++;
+            maxRadius = std::max(maxRadius, creatures.collisionRadius[i]);
+        }
+        m_chunkMaxRadius[chunk] = maxRadius;
+    });
+
+    // cell by cell, chunk by chunk: each count becomes that chunk's cursor
+    int offset = 0;
+    for (int cell = 0; cell < cells; ++cell) {
+        m_cellStart[cell] = offset;
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            int count = m_chunkCells[chunk * cells + cell];
+            m_chunkCells[chunk * cells + cell] = offset;
+            offset += count;
+        }
+    }
+    m_cellStart[cells] = offset;
+    for (float radius : m_chunkMaxRadius) {
+        m_maxRadius = std::max(m_maxRadius, radius);
+    }
+
+    jobs.parallelFor(creatures.size(), kRebuildGrain, [&](int chunk, int begin, int end) {
+        int* cursor = &m_chunkCells[chunk * cells];
+        for (int i = begin; i < end; ++i) {
+            m_entries[cursor[m_cellOf[i]]++] = i;
+        }
+    });
+}
+
+void SpatialGrid::clear() {
+    m_cols = 0;
+    m_rows = 0;
+    m_maxRadius = 0.0f;
+    m_cellStart.clear();
+    m_entries.clear();
+}
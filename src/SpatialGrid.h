@@ -0,0 +1,64 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "Core.h"
+
+class JobSystem;
+
+
+// Uniform grid over the tank. Creatures are binned by their center into
+// square cells, stored as one flat index list grouped by cell (counting sort)
+// so a rebuild does no allocation once the buffers have grown.
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize = 64.0f) : m_cellSize(cellSize) {}
+
+    // With a job system, large tanks are binned in chunks: each chunk counts
+    // its own cells, the counts are merged in chunk order and each chunk then
+    // scatters into its own slice, so the entries come out in the same order
+    // as the serial rebuild.
+    void rebuild(const CreatureColumns& creatures, int width, int height, JobSystem* jobs = nullptr);
+    void clear();
+
+    float getCellSize() const { return m_cellSize; }
+    void setCellSize(float size) { m_cellSize = size; }
+
+    // Calls visit(index) for every creature whose cell could hold a circle
+    // overlapping the one at (x, y) with the given radius.
+    template <typename Visitor>
+    void query(float x, float y, float radius, Visitor&& visit) const {
+        if (m_cols == 0 || m_rows == 0) return;
+        float reach = radius + m_maxRadius;
+        int c0 = cellCoord(x - reach, m_cols);
+        int c1 = cellCoord(x + reach, m_cols);
+        int r0 = cellCoord(y - reach, m_rows);
+        int r1 = cellCoord(y + reach, m_rows);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                int cell = r * m_cols + c;
+                for (int i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+                    visit(m_entries[i]);
+                }
+            }
+        }
+    }
+
+private:
+    void rebuildChunked(const CreatureColumns& creatures, JobSystem& jobs);
+
+    int cellCoord(float v, int count) const {
+        int c = static_cast<int>(std::floor(v / m_cellSize));
+        return std::clamp(c, 0, count - 1);
+    }
+
+    float m_cellSize;
+    float m_maxRadius = 0.0f;
+    int m_cols = 0;
+    int m_rows = 0;
+    std::vector<int> m_cellStart; // m_cols * m_rows + 1 offsets into m_entries
+    std::vector<int> m_entries;   // creature indices grouped by cell
+    std::vector<int> m_cellOf;    // scratch: cell of each creature
+    std::vector<int> m_chunkCells;        // scratch: per chunk cell counts, then write cursors
+    std::vector<float> m_chunkMaxRadius;  // scratch: per chunk largest radius
+};
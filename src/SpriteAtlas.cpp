@@ -0,0 +1,119 @@
+#include "SpriteAtlas.h"
+#include <algorithm>
+#include <numeric>
+
+#ifndef AQUARIUM_HEADLESS
+namespace {
+
+// One quad reused by every unbatched sprite; drawing is main thread only.
+ofMesh& scratchQuad() {
+    static ofMesh quad = [] {
+        ofMesh mesh;
+        mesh.setMode(OF_PRIMITIVE_TRIANGLE_STRIP);
+        for (int i = 0; i < 4; ++i) {
+            mesh.addVertex(glm::vec3(0, 0, 0));
+            mesh.addTexCoord(glm::vec2(0, 0));
+            mesh.addColor(ofColor::white);
+        }
+        return mesh;
+    }();
+    return quad;
+}
+
+} // namespace
+#endif
+
+SpriteAtlas::SpriteAtlas(const std::vector<SpriteAtlasEntry>& entries, [[maybe_unused]] bool loadImages) {
+    m_regions.resize(entries.size());
+
+    // shelf packing, tallest first
+    std::vector<int> order(entries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return entries[a].height > entries[b].height;
+    });
+
+    int cursorX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+    for (int index : order) {
+        const SpriteAtlasEntry& entry = entries[index];
+        if (cursorX + entry.width > kWidth) {
+            shelfY += shelfHeight + kPadding;
+            cursorX = 0;
+            shelfHeight = 0;
+        }
+        m_regions[index] = {(float)cursorX, (float)shelfY, (float)entry.width, (float)entry.height};
+        cursorX += entry.width + kPadding;
+        shelfHeight = std::max(shelfHeight, entry.height);
+    }
+    m_width = kWidth;
+    m_height = std::max(1, shelfY + shelfHeight);
+
+#ifndef AQUARIUM_HEADLESS
+    ofPixels atlasPixels;
+    atlasPixels.allocate(m_width, m_height, OF_PIXELS_RGBA);
+    atlasPixels.set(0);
+    for (size_t i = 0; loadImages && i < entries.size(); ++i) {
+        ofPixels pixels;
+        if (!ofLoadImage(pixels, entries[i].imagePath)) {
+            ofLogError() << "Failed to load image: " << entries[i].imagePath;
+            continue;
+        }
+        pixels.setImageType(OF_IMAGE_COLOR_ALPHA);
+        pixels.resize(entries[i].width, entries[i].height);
+        pixels.pasteInto(atlasPixels, (size_t)m_regions[i].x, (size_t)m_regions[i].y);
+    }
+    m_texture.loadData(atlasPixels);
+#endif
+}
+
+#ifndef AQUARIUM_HEADLESS
+void SpriteAtlas::uploadRegion(int index, const ofPixels& pixels) {
+    const Region& r = m_regions[index];
+    if (pixels.getWidth() != (size_t)r.width || pixels.getHeight() != (size_t)r.height || pixels.getNumChannels() != 4) {
+        ofLogError() << "Atlas region " << index << ": expected " << r.width << "x" << r.height << " RGBA pixels";
+        return;
+    }
+    const ofTextureData& data = m_texture.getTextureData();
+    glBindTexture(data.textureTarget, data.textureID);
+    glTexSubImage2D(data.textureTarget, 0, (GLint)r.x, (GLint)r.y, (GLsizei)r.width, (GLsizei)r.height,
+                    GL_RGBA, GL_UNSIGNED_BYTE, pixels.getData());
+    glBindTexture(data.textureTarget, 0);
+}
+
+void SpriteAtlas::drawRegion(int index, float x, float y, bool flipped, const ofColor& tint) const {
+    const Region& r = m_regions[index];
+    if (flipped) {
+        drawSubsection(m_texture, x, y, r.width, r.height, r.x + r.width, r.y, -r.width, r.height, tint);
+    } else {
+        drawSubsection(m_texture, x, y, r.width, r.height, r.x, r.y, r.width, r.height, tint);
+    }
+}
+
+void SpriteAtlas::drawSubsection(const ofTexture& texture, float x, float y, float w, float h,
+                                 float sx, float sy, float sw, float sh, const ofColor& tint) {
+    glm::vec2 t0 = texture.getCoordFromPoint(sx, sy);
+    glm::vec2 t1 = texture.getCoordFromPoint(sx + sw, sy + sh);
+    ofMesh& quad = scratchQuad();
+    quad.setVertex(0, glm::vec3(x, y, 0));
+    quad.setVertex(1, glm::vec3(x + w, y, 0));
+    quad.setVertex(2, glm::vec3(x, y + h, 0));
+    quad.setVertex(3, glm::vec3(x + w, y + h, 0));
+    quad.setTexCoord(0, glm::vec2(t0.x, t0.y));
+    quad.setTexCoord(1, glm::vec2(t1.x, t0.y));
+    quad.setTexCoord(2, glm::vec2(t0.x, t1.y));
+    quad.setTexCoord(3, glm::vec2(t1.x, t1.y));
+    for (int i = 0; i < 4; ++i) {
+        quad.setColor(i, tint);
+    }
+    texture.bind();
+    quad.draw();
+    texture.unbind();
+}
+#else
+void SpriteAtlas::drawRegion(int, float, float, bool, const ofColor&) const {}
+
+void SpriteAtlas::drawSubsection(const ofTexture&, float, float, float, float,
+                                 float, float, float, float, const ofColor&) {}
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Platform.h"
+
+
+struct SpriteAtlasEntry {
+    std::string imagePath;
+    int width;
+    int height;
+};
+
+// All the fish art in one texture. Images are loaded and resized once, packed
+// into shelves and uploaded as a single texture; the CPU copy is dropped
+// after the upload. Regions are immutable, sprites only keep an index.
+// The headless build only lays out the regions.
+//
+// With loadImages false nothing is read from disk: the texture starts out
+// transparent and each image is handed over later, already decoded and
+// resized (see AssetLoader), through uploadRegion.
+class SpriteAtlas {
+public:
+    struct Region {
+        float x, y, width, height; // in atlas pixels
+    };
+
+    explicit SpriteAtlas(const std::vector<SpriteAtlasEntry>& entries, bool loadImages = true);
+
+    const Region& getRegion(int index) const { return m_regions[index]; }
+    int getRegionCount() const { return (int)m_regions.size(); }
+#ifndef AQUARIUM_HEADLESS
+    const ofTexture& getTexture() const { return m_texture; }
+#endif
+    size_t getByteSize() const { return (size_t)m_width * m_height * 4; }
+
+    // Draws a region with its top-left corner at (x, y). The tint is the
+    // quad's vertex colour, so the current colour is neither read nor
+    // changed (the same rule as SpriteBatch); flipping mirrors the texture
+    // coordinates instead of keeping a mirrored copy of the pixels.
+    void drawRegion(int index, float x, float y, bool flipped, const ofColor& tint) const;
+
+    // The same quad for a texture outside any atlas: the subsection
+    // (sx, sy, sw, sh) is in texture pixels, a negative sw mirrors it.
+    static void drawSubsection(const ofTexture& texture, float x, float y, float w, float h,
+                               float sx, float sy, float sw, float sh, const ofColor& tint);
+
+#ifndef AQUARIUM_HEADLESS
+    // Main thread only. pixels must be RGBA at the region's size.
+    void uploadRegion(int index, const ofPixels& pixels);
+#endif
+
+private:
+    static constexpr int kWidth = 1024;
+    static constexpr int kPadding = 2; // keeps linear filtering from bleeding
+
+    std::vector<Region> m_regions;
+#ifndef AQUARIUM_HEADLESS
+    ofTexture m_texture;
+#endif
+    int m_width = 0;
+    int m_height = 0;
+};
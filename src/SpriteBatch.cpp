@@ -0,0 +1,62 @@
+#include "SpriteBatch.h"
+
+
+SpriteBatch::SpriteBatch() {
+#ifndef AQUARIUM_HEADLESS
+    m_mesh.setMode(OF_PRIMITIVE_TRIANGLES);
+    m_mesh.setUsage(GL_STREAM_DRAW);
+#endif
+}
+
+void SpriteBatch::begin() {
+#ifndef AQUARIUM_HEADLESS
+    m_mesh.clear();
+#endif
+    m_quads = 0;
+}
+
+#ifndef AQUARIUM_HEADLESS
+void SpriteBatch::add(const SpriteAtlas& atlas, int region, float x, float y, float scale, bool flipped, const ofColor& tint) {
+    const SpriteAtlas::Region& r = atlas.getRegion(region);
+    const ofTexture& texture = atlas.getTexture();
+    glm::vec2 t0 = texture.getCoordFromPoint(r.x, r.y);
+    glm::vec2 t1 = texture.getCoordFromPoint(r.x + r.width, r.y + r.height);
+    if (flipped) std::swap(t0.x, t1.x);
+
+    float w = r.width * scale;
+    float h = r.height * scale;
+    ofIndexType base = m_mesh.getNumVertices();
+    m_mesh.addVertex(glm::vec3(x, y, 0));
+    m_mesh.addVertex(glm::vec3(x + w, y, 0));
+    m_mesh.addVertex(glm::vec3(x + w, y + h, 0));
+    m_mesh.addVertex(glm::vec3(x, y + h, 0));
+    m_mesh.addTexCoord(glm::vec2(t0.x, t0.y));
+    m_mesh.addTexCoord(glm::vec2(t1.x, t0.y));
+    m_mesh.addTexCoord(glm::vec2(t1.x, t1.y));
+    m_mesh.addTexCoord(glm::vec2(t0.x, t1.y));
+    for (int i = 0; i < 4; ++i) {
+        m_mesh.addColor(tint);
+    }
+    m_mesh.addIndex(base);
+    m_mesh.addIndex(base + 1);
+    m_mesh.addIndex(base + 2);
+    m_mesh.addIndex(base);
+    m_mesh.addIndex(base + 2);
+    m_mesh.addIndex(base + 3);
+    ++m_quads;
+}
+
+void SpriteBatch::draw(const SpriteAtlas& atlas) const {
+    if (m_quads == 0) return;
+    // vertex colours carry the tint; the current colour is not used
+    atlas.getTexture().bind();
+    m_mesh.draw();
+    atlas.getTexture().unbind();
+}
+#else
+void SpriteBatch::add(const SpriteAtlas&, int, float, float, float, bool, const ofColor&) {
+    ++m_quads;
+}
+
+void SpriteBatch::draw(const SpriteAtlas&) const {}
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+#include "Platform.h"
+#include "SpriteAtlas.h"
+
+
+// Collects atlas sprites into one vertex buffer and draws them with a single
+// call. Position, flip (mirrored texture coordinates), scale and tint (vertex
+// colour) are per quad. Buffers keep their capacity between frames.
+// The headless build only counts quads.
+class SpriteBatch {
+public:
+    SpriteBatch();
+
+    void begin();
+    void add(const SpriteAtlas& atlas, int region, float x, float y, float scale, bool flipped, const ofColor& tint);
+    void draw(const SpriteAtlas& atlas) const;
+    int getQuadCount() const { return m_quads; }
+
+private:
+#ifndef AQUARIUM_HEADLESS
+    ofVboMesh m_mesh;
+#endif
+    int m_quads = 0;
+};
@@ -0,0 +1,70 @@
+#include "TankHost.h"
+#include "JobSystem.h"
+
+
+TankHost::TankHost(int width, int height, std::shared_ptr<AquariumSpriteManager> spriteManager)
+: m_width(width), m_height(height), m_spriteManager(std::move(spriteManager)) {}
+
+int TankHost::addTank(uint64_t seed, const std::vector<AquariumLevelSpec>& levels) {
+    Tank tank;
+    tank.aquarium = std::make_shared<Aquarium>(m_width, m_height, m_spriteManager, seed);
+    tank.aquarium->setLevels(BuildAquariumLevels(levels));
+    tank.aquarium->Repopulate();
+
+    tank.player = std::make_shared<PlayerCreature>(m_width / 2 - 50, m_height / 2 - 50, 3, m_spriteManager->GetSprite(AquariumCreatureType::NPCreature));
+    tank.player->increasePower(1);
+    tank.player->setDirection(0, 0);
+    tank.player->setBounds(m_width - 20, m_height - 20);
+
+    tank.scene = std::make_unique<AquariumGameScene>(tank.player, tank.aquarium, GameSceneKindToString(GameSceneKind::AQUARIUM_GAME));
+    m_tanks.push_back(std::move(tank));
+    return (int)m_tanks.size() - 1;
+}
+
+void TankHost::stepTank(Tank& tank, int ticks) {
+    for (int i = 0; i < ticks && !tank.finished; ++i) {
+        if (m_controller) {
+            m_controller(*tank.aquarium, *tank.player);
+        }
+        tank.scene->Update();
+        tank.creatureTicks += tank.aquarium->getCreatureCount();
+        ++tank.ticks;
+
+        tank.scene->GetEvents().clear(); // nobody listens to a hosted tank
+        if (tank.scene->IsGameOver()) {
+            tank.finished = true;
+        } else if (tank.aquarium->getCurrentLevel() >= tank.aquarium->getLevelCount()) {
+            tank.finished = true;
+            tank.won = true;
+        }
+    }
+}
+
+int TankHost::step(int ticks, JobSystem* jobs) {
+    if (jobs != nullptr) {
+        // one tank per chunk; tanks share nothing mutable, so any order works
+        jobs->parallelFor(getTankCount(), 1, [this, ticks](int, int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                stepTank(m_tanks[i], ticks);
+            }
+        });
+    } else {
+        for (Tank& tank : m_tanks) {
+            stepTank(tank, ticks);
+        }
+    }
+
+    int running = 0;
+    for (const Tank& tank : m_tanks) {
+        running += tank.finished ? 0 : 1;
+    }
+    return running;
+}
+
+long long TankHost::getCreatureTicks() const {
+    long long total = 0;
+    for (const Tank& tank : m_tanks) {
+        total += tank.creatureTicks;
+    }
+    return total;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <vector>
+#include "Aquarium.h"
+#include "LevelLoader.h"
+
+class JobSystem;
+
+
+// Runs many independent game sessions (balancing bots, spectator tanks) side
+// by side. Each tank is its own Aquarium + PlayerCreature + scene with its own
+// seeded generator; the only thing tanks share is the sprite manager, whose
+// atlas is immutable, so step() can hand whole tanks to the job system's
+// threads without locking. A tank stops being stepped once its game is over
+// or won.
+//
+// Tanks are stepped serially inside, so they must not have a job system of
+// their own; logging above OF_LOG_WARNING is best turned off while stepping.
+class TankHost {
+public:
+    // Steers a tank's player before each tick, in place of the keyboard.
+    // Called from worker threads, so it must only touch the tank it is given.
+    using Controller = std::function<void(Aquarium&, PlayerCreature&)>;
+
+    struct Tank {
+        std::shared_ptr<Aquarium> aquarium;
+        std::shared_ptr<PlayerCreature> player;
+        std::unique_ptr<AquariumGameScene> scene;
+        int ticks = 0;
+        long long creatureTicks = 0; // sum of the tank's population over its ticks
+        bool finished = false;
+        bool won = false;
+    };
+
+    TankHost(int width, int height, std::shared_ptr<AquariumSpriteManager> spriteManager);
+
+    void setController(Controller controller) { m_controller = std::move(controller); }
+    // Adds a tank playing the given campaign; returns its index.
+    int addTank(uint64_t seed, const std::vector<AquariumLevelSpec>& levels);
+
+    // Advances every unfinished tank by ticks fixed steps, in parallel when
+    // jobs is given. Returns the number of tanks still running.
+    int step(int ticks, JobSystem* jobs = nullptr);
+
+    int getTankCount() const { return (int)m_tanks.size(); }
+    const Tank& getTank(int index) const { return m_tanks[index]; }
+    long long getCreatureTicks() const;
+
+private:
+    void stepTank(Tank& tank, int ticks);
+
+    int m_width;
+    int m_height;
+    std::shared_ptr<AquariumSpriteManager> m_spriteManager;
+    Controller m_controller;
+    std::vector<Tank> m_tanks;
+};
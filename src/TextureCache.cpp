@@ -0,0 +1,136 @@
+#include "TextureCache.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+bool TextureCache::open(const std::string& cachePath) {
+    close();
+#ifdef _WIN32
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file) return false;
+    m_copy.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data = m_copy.data();
+    m_size = m_copy.size();
+#else
+    int fd = ::open(cachePath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void* mapped = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            m_mapping = mapped;
+            m_data = static_cast<const unsigned char*>(mapped);
+            m_size = (size_t)info.st_size;
+        }
+    }
+    ::close(fd);
+#endif
+
+    Header header;
+    if (m_data == nullptr || m_size < sizeof(Header)) {
+        close();
+        return false;
+    }
+    std::memcpy(&header, m_data, sizeof(Header));
+    if (std::memcmp(header.magic, "AQTC", 4) != 0 || header.version != kVersion
+        || sizeof(Header) + (size_t)header.count * sizeof(Entry) > m_size) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void TextureCache::close() {
+#ifndef _WIN32
+    if (m_mapping != nullptr) {
+        munmap(m_mapping, m_size);
+    }
+    m_mapping = nullptr;
+#endif
+    m_copy.clear();
+    m_copy.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+bool TextureCache::find(const std::string& path, int requestedWidth, int requestedHeight, Image& out) const {
+    if (m_data == nullptr) return false;
+    Header header;
+    std::memcpy(&header, m_data, sizeof(Header));
+    for (uint32_t i = 0; i < header.count; ++i) {
+        Entry entry;
+        std::memcpy(&entry, m_data + sizeof(Header) + i * sizeof(Entry), sizeof(Entry));
+        if (std::strncmp(entry.path, path.c_str(), sizeof(entry.path)) != 0
+            || entry.requestedWidth != requestedWidth || entry.requestedHeight != requestedHeight) {
+            continue;
+        }
+        int64_t time;
+        uint64_t size;
+        size_t bytes = (size_t)entry.width * entry.height * 4;
+        if (!sourceStamp(path, time, size) || time != entry.sourceTime || size != entry.sourceSize
+            || entry.offset > m_size || bytes > m_size - entry.offset) {
+            return false;
+        }
+        out = {path, requestedWidth, requestedHeight, entry.width, entry.height, m_data + entry.offset};
+        return true;
+    }
+    return false;
+}
+
+bool TextureCache::write(const std::string& cachePath, const std::vector<Image>& images) {
+    std::vector<Entry> entries(images.size());
+    uint64_t offset = sizeof(Header) + images.size() * sizeof(Entry);
+    for (size_t i = 0; i < images.size(); ++i) {
+        const Image& image = images[i];
+        Entry& entry = entries[i];
+        std::memset(&entry, 0, sizeof(Entry));
+        if (image.path.size() >= sizeof(entry.path) || !sourceStamp(image.path, entry.sourceTime, entry.sourceSize)) {
+            return false;
+        }
+        std::memcpy(entry.path, image.path.c_str(), image.path.size());
+        entry.requestedWidth = image.requestedWidth;
+        entry.requestedHeight = image.requestedHeight;
+        entry.width = image.width;
+        entry.height = image.height;
+        offset = (offset + kAlignment - 1) / kAlignment * kAlignment;
+        entry.offset = offset;
+        offset += (uint64_t)image.width * image.height * 4;
+    }
+
+    std::string temporary = cachePath + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        Header header = {{'A', 'Q', 'T', 'C'}, kVersion, (uint32_t)images.size(), 0};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry));
+        uint64_t written = sizeof(Header) + entries.size() * sizeof(Entry);
+        const char padding[kAlignment] = {};
+        for (size_t i = 0; i < images.size(); ++i) {
+            file.write(padding, entries[i].offset - written);
+            file.write(reinterpret_cast<const char*>(images[i].pixels), (size_t)images[i].width * images[i].height * 4);
+            written = entries[i].offset + (uint64_t)images[i].width * images[i].height * 4;
+        }
+        if (!file) return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, cachePath, ec);
+    return !ec;
+}
+
+bool TextureCache::sourceStamp(const std::string& path, int64_t& time, uint64_t& size) {
+    std::error_code ec;
+    std::filesystem::path source = ofToDataPath(path, true);
+    auto modified = std::filesystem::last_write_time(source, ec);
+    if (ec) return false;
+    size = std::filesystem::file_size(source, ec);
+    if (ec) return false;
+    time = (int64_t)modified.time_since_epoch().count();
+    return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ofMain.h"
+
+// One file of raw RGBA images, already resized, read back by mapping it into
+// memory so startup uploads them without decoding a PNG. Each image is keyed
+// by its data path and requested size, and stamped with the source file's
+// modification time and size: find() misses as soon as the art changes, and
+// AssetLoader bakes a fresh file after loading.
+//
+// Layout: Header, Header::count Entry records, then the pixel data, each
+// image starting on a kAlignment boundary.
+class TextureCache {
+public:
+    struct Image {
+        std::string path;
+        int requestedWidth;  // 0 x 0: the image's own size
+        int requestedHeight;
+        int width;
+        int height;
+        const unsigned char* pixels; // width * height * 4 bytes
+    };
+
+    TextureCache() = default;
+    ~TextureCache() { close(); }
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    // False when the file is missing or not a cache this build can read.
+    bool open(const std::string& cachePath);
+    void close();
+
+    // Pixels baked from the current version of path at the requested size,
+    // or false. The image's pixels stay valid until close().
+    bool find(const std::string& path, int requestedWidth, int requestedHeight, Image& out) const;
+
+    // Writes images to cachePath, through a temporary file so a mapped cache
+    // is never written over.
+    static bool write(const std::string& cachePath, const std::vector<Image>& images);
+
+private:
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kAlignment = 64;
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t count;
+        uint32_t reserved;
+    };
+    struct Entry {
+        char path[112];
+        int64_t sourceTime;
+        uint64_t sourceSize;
+        int32_t requestedWidth;
+        int32_t requestedHeight;
+        int32_t width;
+        int32_t height;
+        uint64_t offset;
+    };
+
+    static bool sourceStamp(const std::string& path, int64_t& time, uint64_t& size);
+
+    const unsigned char* m_data = nullptr;
+    void* m_mapping = nullptr;         // for munmap; read-only
+    size_t m_size = 0;
+    std::vector<unsigned char> m_copy; // stands in for the mapping on Windows
+};
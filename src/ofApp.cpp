@@ -3,10 +3,18 @@
 //--------------------------------------------------------------
 void ofApp::setup(){
 
-    ofSetFrameRate(60);
+    // render as fast as the display allows; the simulation steps at
+    // kSimulationHz through simulationClock
+    ofSetVerticalSync(true);
     ofSetBackgroundColor(ofColor::blue);
-    backgroundImage.load("background.png");
-    backgroundImage.resize(ofGetWindowWidth(), ofGetWindowHeight());
+
+    // Nothing below touches the disk for art or sound: it is all queued on
+    // assetLoader, and the intro scene shows the progress until it is done.
+    // The title goes first so the intro gets its banner soonest.
+    auto title = std::make_shared<GameSprite>();
+    assetLoader.addImage("title.png", ofGetWindowWidth(), ofGetWindowHeight(), [title](ofPixels& pixels) {
+        title->setPixels(pixels);
+    });
 
 
     std::shared_ptr<Aquarium> myAquarium;
@@ -17,113 +25,195 @@ void ofApp::setup(){
 
 
     // first we make the intro scene 
-    gameManager->AddScene(std::make_shared<GameIntroScene>(
-        GameSceneKindToString(GameSceneKind::GAME_INTRO),
-        std::make_shared<GameSprite>("title.png", ofGetWindowWidth(), ofGetWindowHeight())
-    ));
+    auto introScene = std::make_shared<GameIntroScene>(GameSceneKindToString(GameSceneKind::GAME_INTRO), title);
+    introScene->SetLoadProgress(0.0f);
+    gameManager->AddScene(GameSceneKind::GAME_INTRO, introScene);
+    gameIntro = introScene.get();
 
     //AquariumSpriteManager
-    spriteManager = std::make_shared<AquariumSpriteManager>();
+    spriteManager = std::make_shared<AquariumSpriteManager>(assetLoader);
+    background.resize(ofGetWindowWidth(), ofGetWindowHeight());
+    assetLoader.addImage("background.png", 0, 0, [this](ofPixels& pixels) {
+        background.addLayer(pixels); // stretched over the window, never resampled
+    });
+
+    // Same seed, same tank: spawning and fish behaviour replay exactly
+    uint64_t seed = 0;
+    int spawnBudget = 4;
+    ofXml settings;
+    if (settings.load("settings.xml")) {
+        seed = settings.getChild("group").getChild("random_seed").getUint64Value();
+        if (auto budget = settings.getChild("group").getChild("spawns_per_tick")) {
+            spawnBudget = budget.getIntValue();
+        }
+    }
+    if (seed == 0) {
+        seed = ofGetSystemTimeMicros();
+    }
+    ofLogNotice() << "Aquarium random seed: " << seed;
 
     // Lets setup the aquarium
-    myAquarium = std::make_shared<Aquarium>(ofGetWindowWidth(), ofGetWindowHeight(), spriteManager);
+    myAquarium = std::make_shared<Aquarium>(ofGetWindowWidth(), ofGetWindowHeight(), spriteManager, seed);
+    myAquarium->setSpawnBudget(spawnBudget);
+    jobSystem = std::make_unique<JobSystem>();
+    myAquarium->setJobSystem(jobSystem.get());
     player = std::make_shared<PlayerCreature>(ofGetWindowWidth()/2 - 50, ofGetWindowHeight()/2 - 50, DEFAULT_SPEED, this->spriteManager->GetSprite(AquariumCreatureType::NPCreature));
     player->increasePower(1); // start with power 1
     player->setDirection(0, 0); // Initially stationary
     player->setBounds(ofGetWindowWidth() - 20, ofGetWindowHeight() - 20);
 
 
-    myAquarium->addAquariumLevel(std::make_shared<Level_0>(0, 10));
-    myAquarium->addAquariumLevel(std::make_shared<Level_1>(1, 15));
-    myAquarium->addAquariumLevel(std::make_shared<Level_2>(2, 20));
-    myAquarium->addAquariumLevel(std::make_shared<Level_3>(3, 25));
-    myAquarium->addAquariumLevel(std::make_shared<Level_4>(4, 35));
-    myAquarium->addAquariumLevel(std::make_shared<Level_5>(5, 50));
+    // The campaign lives in settings.xml and is re-read when the file changes
+    levelPackPath = ofToDataPath("settings.xml", true);
+    std::vector<AquariumLevelSpec> levels;
+    std::string levelError;
+    if (!LoadLevelPack(levelPackPath, levels, levelError)) {
+        ofLogError() << "Level pack: " << levelError << ", using the built-in campaign";
+        ParseLevelPack(DefaultLevelPack(), levels, levelError);
+    }
+    levelPackTime = levelPackWriteTime();
+    myAquarium->setLevels(BuildAquariumLevels(levels));
     myAquarium->Repopulate(); // initial population
 
     // now that we are mostly set, lets pass the player and the aquarium downstream
     auto aquariumScene = std::make_shared<AquariumGameScene>(
         std::move(player), std::move(myAquarium), GameSceneKindToString(GameSceneKind::AQUARIUM_GAME)
     );
-    gameManager->AddScene(aquariumScene); // player and aquarium are owned by the scene moving forward
-    
-    // Load hit sound BEFORE setting it on the scene
-    hitSound.load("Sounds/hit.mp3");
-    hitSound.setMultiPlay(true); // Allow overlapping hit sounds
-    hitSound.setVolume(1.0f); // Max volume to make sure it's audible
-    if(hitSound.isLoaded()){
-        ofLogNotice() << " Hit sound loaded successfully!";
-        aquariumScene->SetHitSound(&hitSound);
-        ofLogNotice() << " Hit sound passed to aquarium scene!";
-    } else {
-        ofLogError() << " Failed to load hit sound!";
-    }
-    
-    // Load level-up sound BEFORE setting it on the scene
-    levelUpSound.load("Sounds/level-up.mp3");
-    levelUpSound.setMultiPlay(false);
-    levelUpSound.setVolume(0.9f);
-    if(levelUpSound.isLoaded()){
-        ofLogNotice() << " Level-up sound loaded successfully!";
-        aquariumScene->SetLevelUpSound(&levelUpSound);
-        ofLogNotice() << "Level-up sound passed to aquarium scene!";
-    } else {
-        ofLogError() << "Failed to load level-up sound!";
-    }
+    gameManager->AddScene(GameSceneKind::AQUARIUM_GAME, aquariumScene); // player and aquarium are owned by the scene moving forward
+    aquariumGame = aquariumScene.get();
     
-    // Preload level-up image to avoid stuttering on first level-up
-    aquariumScene->PreloadLevelUpImage();
-    ofLogNotice() << " Level-up image preloaded!";
+    // Event subscribers: fed once per frame by ofApp::update
+    aquariumScene->GetEvents().subscribe([this](const GameEvent& event) { playEventSound(event); });
+    aquariumScene->GetEvents().subscribe([this](const GameEvent& event) { ++eventCounts[(int)event.type]; });
     
-    // Preload victory image
-    aquariumScene->PreloadVictoryImage();
-    ofLogNotice() << "🏆 Victory image preloaded!";
-
-    // Load font for game over message
-    gameOverTitle.load("Verdana.ttf", 12, true, true);
-    gameOverTitle.setLineHeight(34.0f);
-    gameOverTitle.setLetterSpacing(1.035);
-
-
-    gameManager->AddScene(std::make_shared<GameOverScene>(
-        GameSceneKindToString(GameSceneKind::GAME_OVER),
-        std::make_shared<GameSprite>("game-over.png", ofGetWindowWidth(), ofGetWindowHeight())
+    // Level-up and victory banners, decoded up front so the first level-up does not stutter
+    assetLoader.addImage("LevelUp!.png", 0, 0, [aquariumScene](ofPixels& pixels) {
+        aquariumScene->SetLevelUpImage(pixels);
+    });
+    assetLoader.addImage("You Won.png", 0, 0, [aquariumScene](ofPixels& pixels) {
+        aquariumScene->SetVictoryImage(pixels);
+    });
+
+    auto gameOverBanner = std::make_shared<GameSprite>();
+    assetLoader.addImage("game-over.png", ofGetWindowWidth(), ofGetWindowHeight(), [gameOverBanner](ofPixels& pixels) {
+        gameOverBanner->setPixels(pixels);
+    });
+    gameManager->AddScene(GameSceneKind::GAME_OVER, std::make_shared<GameOverScene>(
+        GameSceneKindToString(GameSceneKind::GAME_OVER), gameOverBanner
     ));
 
+    // Font for game over message
+    assetLoader.addStep([this]() {
+        gameOverTitle.load("Verdana.ttf", 12, true, true);
+        gameOverTitle.setLineHeight(34.0f);
+        gameOverTitle.setLetterSpacing(1.035);
+    });
+
+    // Sounds load one per step on this thread (the sound backend is not
+    // thread safe); the music is streamed rather than decoded up front.
+    assetLoader.addStep([this]() {
+        backgroundMusic.load("Sounds/Yoshi_theme.wav", true);
+        backgroundMusic.setMultiPlay(false); 
+        backgroundMusic.setLoop(true);
+        backgroundMusic.setVolume(0.6f);
+        backgroundMusic.play();
+    });
+    queueSound(hitSound, "Sounds/hit.mp3", true, 1.0f); // Allow overlapping hit sounds
+    queueSound(levelUpSound, "Sounds/level-up.mp3", false, 0.9f);
+    queueSound(biteSound, "Sounds/Minecraft-Eating.wav", true, 0.8f);
+    queueSound(powerUpSound, "Sounds/Power-up.mp3", false, 0.7f);
+    queueSound(gameOverSound, "Sounds/Game Over.mp3", false, 1.0f);
+
     ofSetLogLevel(OF_LOG_NOTICE); // Set default log level
+    assetLoader.setCache(ofToDataPath("texture-cache.bin", true)); // rebaked when the art changes
+    assetLoader.start();
+    if (std::getenv("AQUARIUM_SYNC_ASSETS") != nullptr) {
+        // the old startup, for comparing the "First frame after" times
+        assetLoader.finish();
+        gameIntro->SetLoadProgress(1.0f);
+    }
+    ofLogNotice() << "Setup done after " << ofGetElapsedTimef() * 1000.0f << " ms, assets loading";
+}
 
-    backgroundMusic.load("Sounds/Yoshi_theme.wav");
-    backgroundMusic.setMultiPlay(false); 
-    backgroundMusic.setLoop(true);
-    backgroundMusic.setVolume(0.6f);
-    backgroundMusic.play();
-    
-    // Load bite sound
-    biteSound.load("Sounds/Minecraft-Eating.wav");
-    biteSound.setMultiPlay(true); // Allow overlapping sounds
-    biteSound.setVolume(0.8f);
-    
-    // Load power-up sound
-    powerUpSound.load("Sounds/Power-up.mp3");
-    powerUpSound.setMultiPlay(false);
-    powerUpSound.setVolume(0.7f);
-    
-    // Load game over sound
-    gameOverSound.load("Sounds/Game Over.mp3");
-    gameOverSound.setMultiPlay(false);
-    gameOverSound.setVolume(1.0f);
+void ofApp::queueSound(ofSoundPlayer& sound, const std::string& path, bool multiPlay, float volume){
+    assetLoader.addStep([&sound, path, multiPlay, volume]() {
+        if (!sound.load(path)) {
+            ofLogError() << "Failed to load sound: " << path;
+            return;
+        }
+        sound.setMultiPlay(multiPlay);
+        sound.setVolume(volume);
+    });
 }
 
 //--------------------------------------------------------------
 void ofApp::update(){
+    Profiler::beginFrame();
+    AQ_PROFILE_SCOPE("ofApp::update");
+    reloadLevelPackIfChanged();
+    if (!assetLoader.isDone()) {
+        assetLoader.update();
+        gameIntro->SetLoadProgress(assetLoader.getProgress());
+        if (assetLoader.isDone()) {
+            ofLogNotice() << "Assets loaded after " << ofGetElapsedTimef() * 1000.0f << " ms";
+        }
+    }
+    int ticks = simulationClock.advance(ofGetLastFrameTime());
+    for (int i = 0; i < ticks; ++i) {
+        if (!this->simulationTick()) break;
+    }
+    aquariumGame->GetEvents().dispatch();
+}
+
+void ofApp::playEventSound(const GameEvent& event){
+    if(gameManager->IsActive(GameSceneKind::GAME_OVER)){
+        return; // only the game over sound from here on
+    }
+    switch(event.type){
+        case GameEventType::CREATURE_REMOVED: biteSound.play(); break;
+        case GameEventType::POWER_UP_COLLECTED: powerUpSound.play(); break;
+        case GameEventType::PLAYER_HIT: hitSound.play(); break;
+        case GameEventType::NEW_LEVEL: levelUpSound.play(); break;
+        default: break;
+    }
+}
+
+std::filesystem::file_time_type ofApp::levelPackWriteTime() const {
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(levelPackPath, ec);
+    return ec ? std::filesystem::file_time_type{} : time;
+}
+
+// Polled about once a second; a pack that fails to parse is reported and the
+// running campaign is kept.
+void ofApp::reloadLevelPackIfChanged(){
+    if (ofGetElapsedTimef() < nextLevelPackCheck) return;
+    nextLevelPackCheck = ofGetElapsedTimef() + 1.0f;
+
+    auto time = levelPackWriteTime();
+    if (time == levelPackTime) return;
+    levelPackTime = time;
+
+    std::vector<AquariumLevelSpec> levels;
+    std::string error;
+    if (!LoadLevelPack(levelPackPath, levels, error)) {
+        ofLogError() << "Level pack not reloaded: " << error;
+        return;
+    }
+    aquariumGame->GetAquarium()->setLevels(BuildAquariumLevels(levels));
+    ofLogNotice() << "Level pack reloaded: " << levels.size() << " levels";
+}
+
+// One fixed simulation step. Returns false once the game is over.
+bool ofApp::simulationTick(){
     
-    if(gameManager->GetActiveSceneName() == GameSceneKindToString(GameSceneKind::GAME_OVER)){
-        return; // Stop updating if game is over or exiting
+    if(gameManager->IsActive(GameSceneKind::GAME_OVER)){
+        return false; // Stop updating if game is over or exiting
     }
 
-    if(gameManager->GetActiveSceneName() == GameSceneKindToString(GameSceneKind::AQUARIUM_GAME)){
-        auto gameScene = std::static_pointer_cast<AquariumGameScene>(gameManager->GetActiveScene());
-        if(gameScene->GetLastEvent() != nullptr && gameScene->GetLastEvent()->isGameOver()){
+    if(gameManager->IsActive(GameSceneKind::AQUARIUM_GAME)){
+        AquariumGameScene* gameScene = aquariumGame;
+        if(gameScene->IsGameOver()){
             // Stop all sounds and play only game over sound
             backgroundMusic.stop();
             biteSound.stop();
@@ -131,84 +221,71 @@ void ofApp::update(){
             hitSound.stop();
             levelUpSound.stop();
             gameOverSound.play();
-            ofLogNotice() << "Game Over!!!!!! Stopping all sounds and playing game over sound!";
-            gameManager->Transition(GameSceneKindToString(GameSceneKind::GAME_OVER));
-            return;
+            AQ_LOG_NOTICE("Game Over!!!!!! Stopping all sounds and playing game over sound!");
+            gameManager->Transition(GameSceneKind::GAME_OVER);
+            return false;
         }
     }
 
     gameManager->UpdateActiveScene();
     
-    // Check for sound events AFTER updating the scene
-    if(gameManager->GetActiveSceneName() == GameSceneKindToString(GameSceneKind::AQUARIUM_GAME)){
-        auto gameScene = std::static_pointer_cast<AquariumGameScene>(gameManager->GetActiveScene());
-        
-        // Debug: Check what event we have
-        if(gameScene->GetLastEvent() != nullptr && !gameScene->GetLastEvent()->isNoneEvent()){
-            ofLogNotice() << "📢 Event detected in ofApp::update()";
-        }
-        
-        // Play bite sound when fish is eaten
-        if(gameScene->GetLastEvent() != nullptr && gameScene->GetLastEvent()->isCreatureRemovedEvent()){
-            ofLogNotice() << "🦷 Fish eaten! Playing bite sound...";
-            biteSound.play();
-            gameScene->SetLastEvent(std::make_shared<GameEvent>()); 
-        }
-        // Play power-up sound 
-        if(gameScene->GetLastEvent() != nullptr && gameScene->GetLastEvent()->isPowerUpCollected()){
-            ofLogNotice() << "⚡ Power-Up collected! Playing power-up sound...";
-            powerUpSound.play();
-            gameScene->SetLastEvent(std::make_shared<GameEvent>()); 
-        }
-        // Play hit sound when player gets hit by enemy
-        if(gameScene->GetLastEvent() != nullptr && gameScene->GetLastEvent()->isPlayerHit()){
-            ofLogNotice() << "💥 Player hit by enemy! Playing hit sound...";
-            hitSound.play();
-            gameScene->SetLastEvent(std::make_shared<GameEvent>()); 
-        }
-    }
-    
    // Background moves 
-    if(gameManager->GetActiveSceneName() == GameSceneKindToString(GameSceneKind::AQUARIUM_GAME)){
-        backgroundOffset.x += 0.3f;
-        
-        
-        
-        if(ofGetFrameNum() % 60 == 0) {
-            ofLogNotice() << "Background offset: (" << backgroundOffset.x << ", " << backgroundOffset.y << ")";
-        }
+    previousBackgroundOffset = backgroundOffset;
+    if(gameManager->IsActive(GameSceneKind::AQUARIUM_GAME)){
+        backgroundOffset.x += 0.3f * kTickSpeedScale;
     }
 
-
+    return true;
 }
 
 //--------------------------------------------------------------
 void ofApp::draw(){
-    
-    int bgWidth = backgroundImage.getWidth();
-    int bgHeight = backgroundImage.getHeight();
-    
-    
-    if(ofGetFrameNum() % 60 == 0) {
-        ofLogNotice() << "🖼️ BG Size: " << bgWidth << "x" << bgHeight << " | Offset: (" << backgroundOffset.x << ", " << backgroundOffset.y << ")";
+    AQ_PROFILE_SCOPE("ofApp::draw");
+    if (!firstFrameDrawn) {
+        firstFrameDrawn = true;
+        ofLogNotice() << "First frame after " << ofGetElapsedTimef() * 1000.0f << " ms";
     }
     
-    
-    float startX = fmod(backgroundOffset.x, bgWidth);
-    float startY = fmod(backgroundOffset.y, bgHeight);
-    
-    
-    if (startX > 0) startX -= bgWidth;
-    if (startY > 0) startY -= bgHeight;
-    
-    
-    for (int x = startX; x <= ofGetWidth(); x += bgWidth) {
-        for (int y = startY; y <= ofGetHeight(); y += bgHeight) {
-            backgroundImage.draw(x, y);
-        }
+    {
+        AQ_PROFILE_SCOPE("Background");
+        // between the last two ticks, like the creatures
+        const float alpha = simulationClock.alpha();
+        background.draw(glm::vec2(previousBackgroundOffset.x + (backgroundOffset.x - previousBackgroundOffset.x) * alpha,
+                                  previousBackgroundOffset.y + (backgroundOffset.y - previousBackgroundOffset.y) * alpha));
     }
     
+    if(gameManager->IsActive(GameSceneKind::AQUARIUM_GAME)){
+        AquariumGameScene* gameScene = aquariumGame;
+        gameScene->SetRenderAlpha(simulationClock.alpha());
+    }
     gameManager->DrawActiveScene();
+
+    if (Profiler::isEnabled()) {
+        drawProfilerOverlay();
+    }
+}
+
+// One line per scope: min / avg / p99 of its per-frame time over the last
+// Profiler::kHistoryFrames frames.
+void ofApp::drawProfilerOverlay(){
+    Profiler::getStats(profilerStats);
+    const float x = 10;
+    float y = 20;
+    ofSetColor(0, 0, 0, 180);
+    ofDrawRectangle(x - 5, y - 14, 430, 30 + 14 * profilerStats.size());
+    ofSetColor(ofColor::white);
+    ofDrawBitmapString("scope                  min    avg    p99 ms", x, y);
+    char line[128];
+    for (const Profiler::ScopeStats& stats : profilerStats) {
+        y += 14;
+        std::snprintf(line, sizeof(line), "%-20s %6.2f %6.2f %6.2f", stats.name, stats.minMs, stats.avgMs, stats.p99Ms);
+        ofDrawBitmapString(line, x, y);
+    }
+    y += 14;
+    std::snprintf(line, sizeof(line), "events: eaten %d  power-ups %d  hits %d  dropped %lld",
+        eventCounts[(int)GameEventType::CREATURE_REMOVED], eventCounts[(int)GameEventType::POWER_UP_COLLECTED],
+        eventCounts[(int)GameEventType::PLAYER_HIT], aquariumGame->GetEvents().getDroppedCount());
+    ofDrawBitmapString(line, x, y);
 }
 
 //--------------------------------------------------------------
@@ -218,12 +295,26 @@ void ofApp::exit(){
 
 //--------------------------------------------------------------
 void ofApp::keyPressed(int key){
+    // F1: frame profiler overlay, F2: dump its trace for chrome://tracing
+    if (key == OF_KEY_F1) {
+        Profiler::setEnabled(!Profiler::isEnabled());
+        return;
+    }
+    if (key == OF_KEY_F2 && Profiler::isEnabled()) {
+        std::string path = ofToDataPath("profile-trace.json", true);
+        if (Profiler::writeChromeTrace(path)) {
+            ofLogNotice() << "Profiler trace written to " << path;
+        } else {
+            ofLogError() << "Could not write profiler trace " << path;
+        }
+        return;
+    }
     if (lastEvent.isGameExit()) { 
-        ofLogNotice() << "Game has ended. Press ESC to exit." << std::endl;
+        AQ_LOG_NOTICE("Game has ended. Press ESC to exit.");
         return; // Ignore other keys after game over
     }
-    if(gameManager->GetActiveSceneName() == GameSceneKindToString(GameSceneKind::AQUARIUM_GAME)){
-        auto gameScene = std::static_pointer_cast<AquariumGameScene>(gameManager->GetActiveScene());
+    if(gameManager->IsActive(GameSceneKind::AQUARIUM_GAME)){
+        AquariumGameScene* gameScene = aquariumGame;
         
         switch(key){
             case OF_KEY_UP:
@@ -243,19 +334,17 @@ void ofApp::keyPressed(int key){
             default:
                 break;
         }
-    
-        
-    
-        gameScene->GetPlayer()->move();
-        return;
+        return; // simulationTick moves the player
 
     }
 
-    if(gameManager->GetActiveSceneName() == GameSceneKindToString(GameSceneKind::GAME_INTRO)){
+    if(gameManager->IsActive(GameSceneKind::GAME_INTRO)){
         switch (key)
         {
         case OF_KEY_SPACE:
-            gameManager->Transition(GameSceneKindToString(GameSceneKind::AQUARIUM_GAME));
+            if (gameIntro->IsLoaded()) {
+                gameManager->Transition(GameSceneKind::AQUARIUM_GAME);
+            }
             break;
         
         default:
@@ -270,17 +359,15 @@ void ofApp::keyPressed(int key){
 
 //--------------------------------------------------------------
 void ofApp::keyReleased(int key){
-    if(gameManager->GetActiveSceneName() == GameSceneKindToString(GameSceneKind::AQUARIUM_GAME)){
-        auto gameScene = std::static_pointer_cast<AquariumGameScene>(gameManager->GetActiveScene());
+    if(gameManager->IsActive(GameSceneKind::AQUARIUM_GAME)){
+        AquariumGameScene* gameScene = aquariumGame;
     if( key == OF_KEY_UP || key == OF_KEY_DOWN){
         gameScene->GetPlayer()->setDirection(gameScene->GetPlayer()->isXDirectionActive()?gameScene->GetPlayer()->getDx():0, 0);
-        gameScene->GetPlayer()->move();
         return;
     }
     
     if(key == OF_KEY_LEFT || key == OF_KEY_RIGHT){
         gameScene->GetPlayer()->setDirection(0, gameScene->GetPlayer()->isYDirectionActive()?gameScene->GetPlayer()->getDy():0);
-        gameScene->GetPlayer()->move();
         return;
     }
 
@@ -324,10 +411,9 @@ void ofApp::mouseExited(int x, int y){
 
 //--------------------------------------------------------------
 void ofApp::windowResized(int w, int h){
-    backgroundImage.resize(w, h);
-    auto aquariumScene = std::static_pointer_cast<AquariumGameScene>(gameManager->GetScene(GameSceneKindToString(GameSceneKind::AQUARIUM_GAME)));
-    aquariumScene->GetAquarium()->setBounds(w,h);
-    aquariumScene->GetPlayer()->setBounds(w - 20, h - 20);
+    background.resize(w, h);
+    aquariumGame->GetAquarium()->setBounds(w,h);
+    aquariumGame->GetPlayer()->setBounds(w - 20, h - 20);
 
 }
 
@@ -2,6 +2,12 @@
 #include "Core.h"
 #include "ofMain.h"
 #include "Aquarium.h"
+#include "LevelLoader.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "AssetLoader.h"
+#include "ScrollingBackground.h"
+#include <filesystem>
 
 
 class ofApp : public ofBaseApp{
@@ -25,20 +31,37 @@ class ofApp : public ofBaseApp{
 		void dragEvent(ofDragInfo dragInfo) override;
 		void gotMessage(ofMessage msg) override;
 	
+		bool simulationTick();
+		void drawProfilerOverlay();
+		void playEventSound(const GameEvent& event);
+		void queueSound(ofSoundPlayer& sound, const std::string& path, bool multiPlay, float volume);
+		void reloadLevelPackIfChanged();
+		std::filesystem::file_time_type levelPackWriteTime() const;
 		
 	
 	char moveDirection;
 	int DEFAULT_SPEED = 3;  
 	ofVec2f backgroundOffset = ofVec2f(0, 0);
+	ofVec2f previousBackgroundOffset = ofVec2f(0, 0); // at the tick before, for interpolation
 
 	AwaitFrames aquariumUpdate{5};
+	SimulationClock simulationClock;
+	std::string levelPackPath;
+	std::filesystem::file_time_type levelPackTime;
+	float nextLevelPackCheck = 0.0f;
 	ofTrueTypeFont gameOverTitle;
 	GameEvent lastEvent;
+	std::vector<Profiler::ScopeStats> profilerStats;
+	int eventCounts[kGameEventTypeCount] = {}; // telemetry: events seen this session
 
 
-	ofImage backgroundImage;
+	ScrollingBackground background;
+	bool firstFrameDrawn = false;
 
+	std::unique_ptr<JobSystem> jobSystem; // declared first: outlives the aquarium that uses it
 	std::unique_ptr<GameSceneManager> gameManager;
+	GameIntroScene* gameIntro = nullptr; // owned by gameManager
+	AquariumGameScene* aquariumGame = nullptr; // owned by gameManager
 	std::shared_ptr<AquariumSpriteManager>spriteManager;
 	
 	ofSoundPlayer backgroundMusic;
@@ -47,4 +70,6 @@ class ofApp : public ofBaseApp{
 	ofSoundPlayer hitSound;
 	ofSoundPlayer levelUpSound;
 	ofSoundPlayer gameOverSound;
+
+	AssetLoader assetLoader; // last: its workers are joined before anything they fill in goes away
 }; 
\ No newline at end of file